@@ -0,0 +1,179 @@
+#----------------------------------------------------------------
+# Generated CMake target import file for configuration "default".
+#----------------------------------------------------------------
+
+# Commands may need to know the format version.
+set(CMAKE_IMPORT_FILE_VERSION 1)
+
+# Import target "ns3::antenna" for configuration "default"
+set_property(TARGET ns3::antenna APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::antenna PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-antenna-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-antenna-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::antenna )
+list(APPEND _cmake_import_check_files_for_ns3::antenna "${_IMPORT_PREFIX}/lib/libns3-dev-antenna-default.so" )
+
+# Import target "ns3::applications" for configuration "default"
+set_property(TARGET ns3::applications APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::applications PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-applications-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-applications-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::applications )
+list(APPEND _cmake_import_check_files_for_ns3::applications "${_IMPORT_PREFIX}/lib/libns3-dev-applications-default.so" )
+
+# Import target "ns3::bridge" for configuration "default"
+set_property(TARGET ns3::bridge APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::bridge PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-bridge-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-bridge-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::bridge )
+list(APPEND _cmake_import_check_files_for_ns3::bridge "${_IMPORT_PREFIX}/lib/libns3-dev-bridge-default.so" )
+
+# Import target "ns3::core" for configuration "default"
+set_property(TARGET ns3::core APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::core PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-core-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-core-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::core )
+list(APPEND _cmake_import_check_files_for_ns3::core "${_IMPORT_PREFIX}/lib/libns3-dev-core-default.so" )
+
+# Import target "ns3::csma" for configuration "default"
+set_property(TARGET ns3::csma APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::csma PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-csma-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-csma-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::csma )
+list(APPEND _cmake_import_check_files_for_ns3::csma "${_IMPORT_PREFIX}/lib/libns3-dev-csma-default.so" )
+
+# Import target "ns3::energy" for configuration "default"
+set_property(TARGET ns3::energy APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::energy PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-energy-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-energy-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::energy )
+list(APPEND _cmake_import_check_files_for_ns3::energy "${_IMPORT_PREFIX}/lib/libns3-dev-energy-default.so" )
+
+# Import target "ns3::flow-monitor" for configuration "default"
+set_property(TARGET ns3::flow-monitor APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::flow-monitor PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-flow-monitor-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-flow-monitor-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::flow-monitor )
+list(APPEND _cmake_import_check_files_for_ns3::flow-monitor "${_IMPORT_PREFIX}/lib/libns3-dev-flow-monitor-default.so" )
+
+# Import target "ns3::internet" for configuration "default"
+set_property(TARGET ns3::internet APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::internet PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-internet-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-internet-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::internet )
+list(APPEND _cmake_import_check_files_for_ns3::internet "${_IMPORT_PREFIX}/lib/libns3-dev-internet-default.so" )
+
+# Import target "ns3::mobility" for configuration "default"
+set_property(TARGET ns3::mobility APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::mobility PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-mobility-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-mobility-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::mobility )
+list(APPEND _cmake_import_check_files_for_ns3::mobility "${_IMPORT_PREFIX}/lib/libns3-dev-mobility-default.so" )
+
+# Import target "ns3::mtp" for configuration "default"
+set_property(TARGET ns3::mtp APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::mtp PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-mtp-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-mtp-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::mtp )
+list(APPEND _cmake_import_check_files_for_ns3::mtp "${_IMPORT_PREFIX}/lib/libns3-dev-mtp-default.so" )
+
+# Import target "ns3::network" for configuration "default"
+set_property(TARGET ns3::network APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::network PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-network-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-network-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::network )
+list(APPEND _cmake_import_check_files_for_ns3::network "${_IMPORT_PREFIX}/lib/libns3-dev-network-default.so" )
+
+# Import target "ns3::point-to-point" for configuration "default"
+set_property(TARGET ns3::point-to-point APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::point-to-point PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-point-to-point-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-point-to-point-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::point-to-point )
+list(APPEND _cmake_import_check_files_for_ns3::point-to-point "${_IMPORT_PREFIX}/lib/libns3-dev-point-to-point-default.so" )
+
+# Import target "ns3::propagation" for configuration "default"
+set_property(TARGET ns3::propagation APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::propagation PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-propagation-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-propagation-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::propagation )
+list(APPEND _cmake_import_check_files_for_ns3::propagation "${_IMPORT_PREFIX}/lib/libns3-dev-propagation-default.so" )
+
+# Import target "ns3::spectrum" for configuration "default"
+set_property(TARGET ns3::spectrum APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::spectrum PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-spectrum-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-spectrum-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::spectrum )
+list(APPEND _cmake_import_check_files_for_ns3::spectrum "${_IMPORT_PREFIX}/lib/libns3-dev-spectrum-default.so" )
+
+# Import target "ns3::stats" for configuration "default"
+set_property(TARGET ns3::stats APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::stats PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-stats-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-stats-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::stats )
+list(APPEND _cmake_import_check_files_for_ns3::stats "${_IMPORT_PREFIX}/lib/libns3-dev-stats-default.so" )
+
+# Import target "ns3::traffic-control" for configuration "default"
+set_property(TARGET ns3::traffic-control APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::traffic-control PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-traffic-control-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-traffic-control-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::traffic-control )
+list(APPEND _cmake_import_check_files_for_ns3::traffic-control "${_IMPORT_PREFIX}/lib/libns3-dev-traffic-control-default.so" )
+
+# Import target "ns3::wifi" for configuration "default"
+set_property(TARGET ns3::wifi APPEND PROPERTY IMPORTED_CONFIGURATIONS DEFAULT)
+set_target_properties(ns3::wifi PROPERTIES
+  IMPORTED_LOCATION_DEFAULT "${_IMPORT_PREFIX}/lib/libns3-dev-wifi-default.so"
+  IMPORTED_SONAME_DEFAULT "libns3-dev-wifi-default.so"
+  )
+
+list(APPEND _cmake_import_check_targets ns3::wifi )
+list(APPEND _cmake_import_check_files_for_ns3::wifi "${_IMPORT_PREFIX}/lib/libns3-dev-wifi-default.so" )
+
+# Commands beyond this point should not need to know the version.
+set(CMAKE_IMPORT_FILE_VERSION)
@@ -0,0 +1,258 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "CMakeFiles/VerifyGlobs.cmake"
+  "CMakeFiles/cmake.verify_globs"
+  "/root/repo/build-support/3rd-party/FindEigen3.cmake"
+  "/root/repo/build-support/3rd-party/FindHarfBuzz.cmake"
+  "/root/repo/build-support/3rd-party/FindSphinx.cmake"
+  "/root/repo/build-support/3rd-party/colored-messages.cmake"
+  "/root/repo/build-support/3rd-party/find-program-hints.cmake"
+  "/root/repo/build-support/Config.cmake.in"
+  "/root/repo/build-support/core-config-template.h"
+  "/root/repo/build-support/custom-modules/ns3-check-dependencies.cmake"
+  "/root/repo/build-support/custom-modules/ns3-cmake-package.cmake"
+  "/root/repo/build-support/custom-modules/ns3-compiler-and-linker-support.cmake"
+  "/root/repo/build-support/custom-modules/ns3-compiler-workarounds.cmake"
+  "/root/repo/build-support/custom-modules/ns3-configtable.cmake"
+  "/root/repo/build-support/custom-modules/ns3-contributions.cmake"
+  "/root/repo/build-support/custom-modules/ns3-executables.cmake"
+  "/root/repo/build-support/custom-modules/ns3-filter-modules.cmake"
+  "/root/repo/build-support/custom-modules/ns3-find-external-library.cmake"
+  "/root/repo/build-support/custom-modules/ns3-hidden-settings.cmake"
+  "/root/repo/build-support/custom-modules/ns3-lock.cmake"
+  "/root/repo/build-support/custom-modules/ns3-module-macros.cmake"
+  "/root/repo/build-support/custom-modules/ns3-ns3rc-parser.cmake"
+  "/root/repo/build-support/custom-modules/ns3-output-directory.cmake"
+  "/root/repo/build-support/custom-modules/ns3-platform-support.cmake"
+  "/root/repo/build-support/custom-modules/ns3-vcpkg-hunter.cmake"
+  "/root/repo/build-support/custom-modules/ns3-versioning.cmake"
+  "/root/repo/build-support/macros-and-definitions.cmake"
+  "/root/repo/build-support/pkgconfig-template.pc.in"
+  "/root/repo/examples/CMakeLists.txt"
+  "/root/repo/scratch/CMakeLists.txt"
+  "/root/repo/scratch/nested-subdir/CMakeLists.txt"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/antenna/CMakeLists.txt"
+  "/root/repo/src/applications/CMakeLists.txt"
+  "/root/repo/src/bridge/CMakeLists.txt"
+  "/root/repo/src/core/CMakeLists.txt"
+  "/root/repo/src/csma/CMakeLists.txt"
+  "/root/repo/src/energy/CMakeLists.txt"
+  "/root/repo/src/flow-monitor/CMakeLists.txt"
+  "/root/repo/src/internet/CMakeLists.txt"
+  "/root/repo/src/mobility/CMakeLists.txt"
+  "/root/repo/src/mtp/CMakeLists.txt"
+  "/root/repo/src/network/CMakeLists.txt"
+  "/root/repo/src/point-to-point/CMakeLists.txt"
+  "/root/repo/src/propagation/CMakeLists.txt"
+  "/root/repo/src/spectrum/CMakeLists.txt"
+  "/root/repo/src/stats/CMakeLists.txt"
+  "/root/repo/src/test/CMakeLists.txt"
+  "/root/repo/src/traffic-control/CMakeLists.txt"
+  "/root/repo/src/wifi/CMakeLists.txt"
+  "/root/repo/utils/CMakeLists.txt"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfig.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/Boost-1.74.0/BoostConfigVersion.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config-version.cmake"
+  "/usr/lib/x86_64-linux-gnu/cmake/boost_headers-1.74.0/boost_headers-config.cmake"
+  "/usr/share/cmake-3.25/Modules/BasicConfigVersion-ExactVersion.cmake.in"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakePackageConfigHelpers.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckFunctionExists.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFileCXX.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/FindBoost.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindGit.cmake"
+  "/usr/share/cmake-3.25/Modules/FindLibXml2.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/GNUInstallDirs.cmake"
+  "/usr/share/cmake-3.25/Modules/GenerateExportHeader.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/ProcessorCount.cmake"
+  "/usr/share/cmake-3.25/Modules/WriteBasicConfigVersionFile.cmake"
+  "/usr/share/cmake-3.25/Modules/exportheader.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "out/include/ns3/core-config.h"
+  "pkgconfig/ns3-wifi.pc"
+  "pkgconfig/ns3-traffic-control.pc"
+  "pkgconfig/ns3-stats.pc"
+  "pkgconfig/ns3-spectrum.pc"
+  "pkgconfig/ns3-propagation.pc"
+  "pkgconfig/ns3-point-to-point.pc"
+  "pkgconfig/ns3-network.pc"
+  "pkgconfig/ns3-mtp.pc"
+  "pkgconfig/ns3-mobility.pc"
+  "pkgconfig/ns3-internet.pc"
+  "pkgconfig/ns3-flow-monitor.pc"
+  "pkgconfig/ns3-energy.pc"
+  "pkgconfig/ns3-csma.pc"
+  "pkgconfig/ns3-core.pc"
+  "pkgconfig/ns3-bridge.pc"
+  "pkgconfig/ns3-applications.pc"
+  "pkgconfig/ns3-antenna.pc"
+  "ns3Config.cmake"
+  "ns3ConfigVersion.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/antenna/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/applications/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/bridge/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/core/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/csma/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/energy/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/flow-monitor/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "out/include/ns3/internet-export.h"
+  "src/internet/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/mobility/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/mtp/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/network/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/point-to-point/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/propagation/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/spectrum/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/stats/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/test/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/traffic-control/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/wifi/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "scratch/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "scratch/nested-subdir/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "utils/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/uninstall.dir/DependInfo.cmake"
+  "CMakeFiles/copy_all_headers.dir/DependInfo.cmake"
+  "CMakeFiles/check-version.dir/DependInfo.cmake"
+  "CMakeFiles/test-runner-examples-as-tests.dir/DependInfo.cmake"
+  "CMakeFiles/all-test-targets.dir/DependInfo.cmake"
+  "CMakeFiles/run_test_py.dir/DependInfo.cmake"
+  "CMakeFiles/run-print-introspected-doxygen.dir/DependInfo.cmake"
+  "CMakeFiles/run-introspected-command-line.dir/DependInfo.cmake"
+  "CMakeFiles/assemble-introspected-command-line.dir/DependInfo.cmake"
+  "CMakeFiles/update_doxygen_version.dir/DependInfo.cmake"
+  "CMakeFiles/doxygen.dir/DependInfo.cmake"
+  "CMakeFiles/doxygen-no-build.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_manual.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_models.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_tutorial.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_contributing.dir/DependInfo.cmake"
+  "CMakeFiles/sphinx_installation.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_wifi.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_traffic-control.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_stats.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_spectrum.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_propagation.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_point-to-point.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_network.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_mtp.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_mobility.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_internet.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_flow-monitor.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_energy.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_csma.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_core.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_bridge.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_applications.dir/DependInfo.cmake"
+  "CMakeFiles/uninstall_pkgconfig_antenna.dir/DependInfo.cmake"
+  "src/antenna/CMakeFiles/antenna.dir/DependInfo.cmake"
+  "src/antenna/CMakeFiles/antenna-test.dir/DependInfo.cmake"
+  "src/applications/CMakeFiles/applications.dir/DependInfo.cmake"
+  "src/applications/CMakeFiles/applications-test.dir/DependInfo.cmake"
+  "src/bridge/CMakeFiles/bridge.dir/DependInfo.cmake"
+  "src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  "src/core/CMakeFiles/core-test.dir/DependInfo.cmake"
+  "src/csma/CMakeFiles/csma.dir/DependInfo.cmake"
+  "src/energy/CMakeFiles/energy.dir/DependInfo.cmake"
+  "src/energy/CMakeFiles/energy-test.dir/DependInfo.cmake"
+  "src/flow-monitor/CMakeFiles/flow-monitor.dir/DependInfo.cmake"
+  "src/flow-monitor/CMakeFiles/flow-monitor-test.dir/DependInfo.cmake"
+  "src/internet/CMakeFiles/internet.dir/DependInfo.cmake"
+  "src/internet/CMakeFiles/internet-test.dir/DependInfo.cmake"
+  "src/mobility/CMakeFiles/mobility.dir/DependInfo.cmake"
+  "src/mobility/CMakeFiles/mobility-test.dir/DependInfo.cmake"
+  "src/mtp/CMakeFiles/mtp.dir/DependInfo.cmake"
+  "src/mtp/CMakeFiles/mtp-test.dir/DependInfo.cmake"
+  "src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "src/network/CMakeFiles/network-test.dir/DependInfo.cmake"
+  "src/point-to-point/CMakeFiles/point-to-point.dir/DependInfo.cmake"
+  "src/point-to-point/CMakeFiles/point-to-point-test.dir/DependInfo.cmake"
+  "src/propagation/CMakeFiles/propagation.dir/DependInfo.cmake"
+  "src/propagation/CMakeFiles/propagation-test.dir/DependInfo.cmake"
+  "src/spectrum/CMakeFiles/spectrum.dir/DependInfo.cmake"
+  "src/spectrum/CMakeFiles/spectrum-test.dir/DependInfo.cmake"
+  "src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "src/stats/CMakeFiles/stats-test.dir/DependInfo.cmake"
+  "src/test/CMakeFiles/test.dir/DependInfo.cmake"
+  "src/traffic-control/CMakeFiles/traffic-control.dir/DependInfo.cmake"
+  "src/traffic-control/CMakeFiles/traffic-control-test.dir/DependInfo.cmake"
+  "src/wifi/CMakeFiles/wifi.dir/DependInfo.cmake"
+  "src/wifi/CMakeFiles/wifi-test.dir/DependInfo.cmake"
+  "scratch/CMakeFiles/scratch_scratch-simulator.dir/DependInfo.cmake"
+  "scratch/CMakeFiles/scratch_zz-tcbench.dir/DependInfo.cmake"
+  "scratch/CMakeFiles/scratch_subdir_scratch-subdir.dir/DependInfo.cmake"
+  "scratch/nested-subdir/CMakeFiles/scratch-nested-subdir-lib.dir/DependInfo.cmake"
+  "scratch/nested-subdir/CMakeFiles/scratch_nested-subdir_scratch-nested-subdir-executable.dir/DependInfo.cmake"
+  "utils/CMakeFiles/test-runner.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-scheduler.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-inject.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-packets.dir/DependInfo.cmake"
+  "utils/CMakeFiles/convert-binary-ascii-trace.dir/DependInfo.cmake"
+  "utils/CMakeFiles/print-introspected-doxygen.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-tcp-sack.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-get-object.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-traced-callback.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-config.dir/DependInfo.cmake"
+  "utils/CMakeFiles/bench-spectrum-value.dir/DependInfo.cmake"
+  "utils/CMakeFiles/perf-io.dir/DependInfo.cmake"
+  )
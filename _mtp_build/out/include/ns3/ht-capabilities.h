@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/ht/ht-capabilities.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/spectrum/model/matrix-based-channel-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/he/rr-multi-user-scheduler.h"
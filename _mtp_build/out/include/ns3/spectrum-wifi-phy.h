@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/spectrum-wifi-phy.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/spectrum/model/two-ray-spectrum-propagation-loss-model.h"
@@ -0,0 +1 @@
+#include "/root/repo/src/wifi/model/wifi-assoc-manager.h"
@@ -0,0 +1,36 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/scratch/scratch-simulator.cc" "scratch/CMakeFiles/scratch_scratch-simulator.dir/scratch-simulator.cc.o" "gcc" "scratch/CMakeFiles/scratch_scratch-simulator.dir/scratch-simulator.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mtp_build/src/wifi/CMakeFiles/wifi.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/spectrum/CMakeFiles/spectrum.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/propagation/CMakeFiles/propagation.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/point-to-point/CMakeFiles/point-to-point.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/mtp/CMakeFiles/mtp.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/mobility/CMakeFiles/mobility.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/flow-monitor/CMakeFiles/flow-monitor.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/energy/CMakeFiles/energy.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/csma/CMakeFiles/csma.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/applications/CMakeFiles/applications.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/antenna/CMakeFiles/antenna.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/internet/CMakeFiles/internet.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/traffic-control/CMakeFiles/traffic-control.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/bridge/CMakeFiles/bridge.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../out/scratch/ns3-dev-zz-tcbench-default"
+  "../out/scratch/ns3-dev-zz-tcbench-default.pdb"
+  "CMakeFiles/scratch_zz-tcbench.dir/zz-tcbench.cc.o"
+  "CMakeFiles/scratch_zz-tcbench.dir/zz-tcbench.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scratch_zz-tcbench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
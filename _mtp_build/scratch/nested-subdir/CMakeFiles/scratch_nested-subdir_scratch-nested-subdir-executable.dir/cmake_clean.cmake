@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/scratch/nested-subdir/ns3-dev-scratch-nested-subdir-executable-default"
+  "../../out/scratch/nested-subdir/ns3-dev-scratch-nested-subdir-executable-default.pdb"
+  "CMakeFiles/scratch_nested-subdir_scratch-nested-subdir-executable.dir/scratch-nested-subdir-executable.cc.o"
+  "CMakeFiles/scratch_nested-subdir_scratch-nested-subdir-executable.dir/scratch-nested-subdir-executable.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scratch_nested-subdir_scratch-nested-subdir-executable.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-antenna-test-default.pdb"
+  "../../out/lib/libns3-dev-antenna-test-default.so"
+  "CMakeFiles/antenna-test.dir/test/test-adjacency-matrix.cc.o"
+  "CMakeFiles/antenna-test.dir/test/test-adjacency-matrix.cc.o.d"
+  "CMakeFiles/antenna-test.dir/test/test-angles.cc.o"
+  "CMakeFiles/antenna-test.dir/test/test-angles.cc.o.d"
+  "CMakeFiles/antenna-test.dir/test/test-circular-aperture-antenna.cc.o"
+  "CMakeFiles/antenna-test.dir/test/test-circular-aperture-antenna.cc.o.d"
+  "CMakeFiles/antenna-test.dir/test/test-cosine-antenna.cc.o"
+  "CMakeFiles/antenna-test.dir/test/test-cosine-antenna.cc.o.d"
+  "CMakeFiles/antenna-test.dir/test/test-degrees-radians.cc.o"
+  "CMakeFiles/antenna-test.dir/test/test-degrees-radians.cc.o.d"
+  "CMakeFiles/antenna-test.dir/test/test-isotropic-antenna.cc.o"
+  "CMakeFiles/antenna-test.dir/test/test-isotropic-antenna.cc.o.d"
+  "CMakeFiles/antenna-test.dir/test/test-parabolic-antenna.cc.o"
+  "CMakeFiles/antenna-test.dir/test/test-parabolic-antenna.cc.o.d"
+  "CMakeFiles/antenna-test.dir/test/test-uniform-planar-array.cc.o"
+  "CMakeFiles/antenna-test.dir/test/test-uniform-planar-array.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/antenna-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
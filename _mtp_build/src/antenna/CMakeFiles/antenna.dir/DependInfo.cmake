@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/antenna/model/angles.cc" "src/antenna/CMakeFiles/antenna.dir/model/angles.cc.o" "gcc" "src/antenna/CMakeFiles/antenna.dir/model/angles.cc.o.d"
+  "/root/repo/src/antenna/model/antenna-model.cc" "src/antenna/CMakeFiles/antenna.dir/model/antenna-model.cc.o" "gcc" "src/antenna/CMakeFiles/antenna.dir/model/antenna-model.cc.o.d"
+  "/root/repo/src/antenna/model/circular-aperture-antenna-model.cc" "src/antenna/CMakeFiles/antenna.dir/model/circular-aperture-antenna-model.cc.o" "gcc" "src/antenna/CMakeFiles/antenna.dir/model/circular-aperture-antenna-model.cc.o.d"
+  "/root/repo/src/antenna/model/cosine-antenna-model.cc" "src/antenna/CMakeFiles/antenna.dir/model/cosine-antenna-model.cc.o" "gcc" "src/antenna/CMakeFiles/antenna.dir/model/cosine-antenna-model.cc.o.d"
+  "/root/repo/src/antenna/model/isotropic-antenna-model.cc" "src/antenna/CMakeFiles/antenna.dir/model/isotropic-antenna-model.cc.o" "gcc" "src/antenna/CMakeFiles/antenna.dir/model/isotropic-antenna-model.cc.o.d"
+  "/root/repo/src/antenna/model/parabolic-antenna-model.cc" "src/antenna/CMakeFiles/antenna.dir/model/parabolic-antenna-model.cc.o" "gcc" "src/antenna/CMakeFiles/antenna.dir/model/parabolic-antenna-model.cc.o.d"
+  "/root/repo/src/antenna/model/phased-array-model.cc" "src/antenna/CMakeFiles/antenna.dir/model/phased-array-model.cc.o" "gcc" "src/antenna/CMakeFiles/antenna.dir/model/phased-array-model.cc.o.d"
+  "/root/repo/src/antenna/model/three-gpp-antenna-model.cc" "src/antenna/CMakeFiles/antenna.dir/model/three-gpp-antenna-model.cc.o" "gcc" "src/antenna/CMakeFiles/antenna.dir/model/three-gpp-antenna-model.cc.o.d"
+  "/root/repo/src/antenna/model/uniform-planar-array.cc" "src/antenna/CMakeFiles/antenna.dir/model/uniform-planar-array.cc.o" "gcc" "src/antenna/CMakeFiles/antenna.dir/model/uniform-planar-array.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mtp_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
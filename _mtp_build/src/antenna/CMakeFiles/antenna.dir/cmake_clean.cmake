@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-antenna-default.pdb"
+  "../../out/lib/libns3-dev-antenna-default.so"
+  "CMakeFiles/antenna.dir/model/angles.cc.o"
+  "CMakeFiles/antenna.dir/model/angles.cc.o.d"
+  "CMakeFiles/antenna.dir/model/antenna-model.cc.o"
+  "CMakeFiles/antenna.dir/model/antenna-model.cc.o.d"
+  "CMakeFiles/antenna.dir/model/circular-aperture-antenna-model.cc.o"
+  "CMakeFiles/antenna.dir/model/circular-aperture-antenna-model.cc.o.d"
+  "CMakeFiles/antenna.dir/model/cosine-antenna-model.cc.o"
+  "CMakeFiles/antenna.dir/model/cosine-antenna-model.cc.o.d"
+  "CMakeFiles/antenna.dir/model/isotropic-antenna-model.cc.o"
+  "CMakeFiles/antenna.dir/model/isotropic-antenna-model.cc.o.d"
+  "CMakeFiles/antenna.dir/model/parabolic-antenna-model.cc.o"
+  "CMakeFiles/antenna.dir/model/parabolic-antenna-model.cc.o.d"
+  "CMakeFiles/antenna.dir/model/phased-array-model.cc.o"
+  "CMakeFiles/antenna.dir/model/phased-array-model.cc.o.d"
+  "CMakeFiles/antenna.dir/model/three-gpp-antenna-model.cc.o"
+  "CMakeFiles/antenna.dir/model/three-gpp-antenna-model.cc.o.d"
+  "CMakeFiles/antenna.dir/model/uniform-planar-array.cc.o"
+  "CMakeFiles/antenna.dir/model/uniform-planar-array.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/antenna.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
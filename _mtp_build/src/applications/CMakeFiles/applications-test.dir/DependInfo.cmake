@@ -0,0 +1,28 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/applications/test/bulk-send-application-test-suite.cc" "src/applications/CMakeFiles/applications-test.dir/test/bulk-send-application-test-suite.cc.o" "gcc" "src/applications/CMakeFiles/applications-test.dir/test/bulk-send-application-test-suite.cc.o.d"
+  "/root/repo/src/applications/test/three-gpp-http-client-server-test.cc" "src/applications/CMakeFiles/applications-test.dir/test/three-gpp-http-client-server-test.cc.o" "gcc" "src/applications/CMakeFiles/applications-test.dir/test/three-gpp-http-client-server-test.cc.o.d"
+  "/root/repo/src/applications/test/udp-client-server-test.cc" "src/applications/CMakeFiles/applications-test.dir/test/udp-client-server-test.cc.o" "gcc" "src/applications/CMakeFiles/applications-test.dir/test/udp-client-server-test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mtp_build/src/applications/CMakeFiles/applications.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/internet/CMakeFiles/internet.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/bridge/CMakeFiles/bridge.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/traffic-control/CMakeFiles/traffic-control.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-applications-test-default.pdb"
+  "../../out/lib/libns3-dev-applications-test-default.so"
+  "CMakeFiles/applications-test.dir/test/bulk-send-application-test-suite.cc.o"
+  "CMakeFiles/applications-test.dir/test/bulk-send-application-test-suite.cc.o.d"
+  "CMakeFiles/applications-test.dir/test/three-gpp-http-client-server-test.cc.o"
+  "CMakeFiles/applications-test.dir/test/three-gpp-http-client-server-test.cc.o.d"
+  "CMakeFiles/applications-test.dir/test/udp-client-server-test.cc.o"
+  "CMakeFiles/applications-test.dir/test/udp-client-server-test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/applications-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
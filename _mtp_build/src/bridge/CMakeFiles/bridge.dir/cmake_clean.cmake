@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-bridge-default.pdb"
+  "../../out/lib/libns3-dev-bridge-default.so"
+  "CMakeFiles/bridge.dir/helper/bridge-helper.cc.o"
+  "CMakeFiles/bridge.dir/helper/bridge-helper.cc.o.d"
+  "CMakeFiles/bridge.dir/model/bridge-channel.cc.o"
+  "CMakeFiles/bridge.dir/model/bridge-channel.cc.o.d"
+  "CMakeFiles/bridge.dir/model/bridge-net-device.cc.o"
+  "CMakeFiles/bridge.dir/model/bridge-net-device.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bridge.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-csma-default.pdb"
+  "../../out/lib/libns3-dev-csma-default.so"
+  "CMakeFiles/csma.dir/helper/csma-helper.cc.o"
+  "CMakeFiles/csma.dir/helper/csma-helper.cc.o.d"
+  "CMakeFiles/csma.dir/model/backoff.cc.o"
+  "CMakeFiles/csma.dir/model/backoff.cc.o.d"
+  "CMakeFiles/csma.dir/model/csma-channel.cc.o"
+  "CMakeFiles/csma.dir/model/csma-channel.cc.o.d"
+  "CMakeFiles/csma.dir/model/csma-net-device.cc.o"
+  "CMakeFiles/csma.dir/model/csma-net-device.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/csma.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/energy/test/basic-energy-harvester-test.cc" "src/energy/CMakeFiles/energy-test.dir/test/basic-energy-harvester-test.cc.o" "gcc" "src/energy/CMakeFiles/energy-test.dir/test/basic-energy-harvester-test.cc.o.d"
+  "/root/repo/src/energy/test/li-ion-energy-source-test.cc" "src/energy/CMakeFiles/energy-test.dir/test/li-ion-energy-source-test.cc.o" "gcc" "src/energy/CMakeFiles/energy-test.dir/test/li-ion-energy-source-test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mtp_build/src/energy/CMakeFiles/energy.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,40 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/energy/helper/basic-energy-harvester-helper.cc" "src/energy/CMakeFiles/energy.dir/helper/basic-energy-harvester-helper.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/helper/basic-energy-harvester-helper.cc.o.d"
+  "/root/repo/src/energy/helper/basic-energy-source-helper.cc" "src/energy/CMakeFiles/energy.dir/helper/basic-energy-source-helper.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/helper/basic-energy-source-helper.cc.o.d"
+  "/root/repo/src/energy/helper/energy-harvester-container.cc" "src/energy/CMakeFiles/energy.dir/helper/energy-harvester-container.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/helper/energy-harvester-container.cc.o.d"
+  "/root/repo/src/energy/helper/energy-harvester-helper.cc" "src/energy/CMakeFiles/energy.dir/helper/energy-harvester-helper.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/helper/energy-harvester-helper.cc.o.d"
+  "/root/repo/src/energy/helper/energy-model-helper.cc" "src/energy/CMakeFiles/energy.dir/helper/energy-model-helper.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/helper/energy-model-helper.cc.o.d"
+  "/root/repo/src/energy/helper/energy-source-container.cc" "src/energy/CMakeFiles/energy.dir/helper/energy-source-container.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/helper/energy-source-container.cc.o.d"
+  "/root/repo/src/energy/helper/generic-battery-model-helper.cc" "src/energy/CMakeFiles/energy.dir/helper/generic-battery-model-helper.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/helper/generic-battery-model-helper.cc.o.d"
+  "/root/repo/src/energy/helper/li-ion-energy-source-helper.cc" "src/energy/CMakeFiles/energy.dir/helper/li-ion-energy-source-helper.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/helper/li-ion-energy-source-helper.cc.o.d"
+  "/root/repo/src/energy/helper/rv-battery-model-helper.cc" "src/energy/CMakeFiles/energy.dir/helper/rv-battery-model-helper.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/helper/rv-battery-model-helper.cc.o.d"
+  "/root/repo/src/energy/model/basic-energy-harvester.cc" "src/energy/CMakeFiles/energy.dir/model/basic-energy-harvester.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/model/basic-energy-harvester.cc.o.d"
+  "/root/repo/src/energy/model/basic-energy-source.cc" "src/energy/CMakeFiles/energy.dir/model/basic-energy-source.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/model/basic-energy-source.cc.o.d"
+  "/root/repo/src/energy/model/device-energy-model-container.cc" "src/energy/CMakeFiles/energy.dir/model/device-energy-model-container.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/model/device-energy-model-container.cc.o.d"
+  "/root/repo/src/energy/model/device-energy-model.cc" "src/energy/CMakeFiles/energy.dir/model/device-energy-model.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/model/device-energy-model.cc.o.d"
+  "/root/repo/src/energy/model/energy-harvester.cc" "src/energy/CMakeFiles/energy.dir/model/energy-harvester.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/model/energy-harvester.cc.o.d"
+  "/root/repo/src/energy/model/energy-source.cc" "src/energy/CMakeFiles/energy.dir/model/energy-source.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/model/energy-source.cc.o.d"
+  "/root/repo/src/energy/model/generic-battery-model.cc" "src/energy/CMakeFiles/energy.dir/model/generic-battery-model.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/model/generic-battery-model.cc.o.d"
+  "/root/repo/src/energy/model/li-ion-energy-source.cc" "src/energy/CMakeFiles/energy.dir/model/li-ion-energy-source.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/model/li-ion-energy-source.cc.o.d"
+  "/root/repo/src/energy/model/rv-battery-model.cc" "src/energy/CMakeFiles/energy.dir/model/rv-battery-model.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/model/rv-battery-model.cc.o.d"
+  "/root/repo/src/energy/model/simple-device-energy-model.cc" "src/energy/CMakeFiles/energy.dir/model/simple-device-energy-model.cc.o" "gcc" "src/energy/CMakeFiles/energy.dir/model/simple-device-energy-model.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mtp_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
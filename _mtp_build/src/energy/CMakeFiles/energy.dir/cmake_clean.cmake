@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-energy-default.pdb"
+  "../../out/lib/libns3-dev-energy-default.so"
+  "CMakeFiles/energy.dir/helper/basic-energy-harvester-helper.cc.o"
+  "CMakeFiles/energy.dir/helper/basic-energy-harvester-helper.cc.o.d"
+  "CMakeFiles/energy.dir/helper/basic-energy-source-helper.cc.o"
+  "CMakeFiles/energy.dir/helper/basic-energy-source-helper.cc.o.d"
+  "CMakeFiles/energy.dir/helper/energy-harvester-container.cc.o"
+  "CMakeFiles/energy.dir/helper/energy-harvester-container.cc.o.d"
+  "CMakeFiles/energy.dir/helper/energy-harvester-helper.cc.o"
+  "CMakeFiles/energy.dir/helper/energy-harvester-helper.cc.o.d"
+  "CMakeFiles/energy.dir/helper/energy-model-helper.cc.o"
+  "CMakeFiles/energy.dir/helper/energy-model-helper.cc.o.d"
+  "CMakeFiles/energy.dir/helper/energy-source-container.cc.o"
+  "CMakeFiles/energy.dir/helper/energy-source-container.cc.o.d"
+  "CMakeFiles/energy.dir/helper/generic-battery-model-helper.cc.o"
+  "CMakeFiles/energy.dir/helper/generic-battery-model-helper.cc.o.d"
+  "CMakeFiles/energy.dir/helper/li-ion-energy-source-helper.cc.o"
+  "CMakeFiles/energy.dir/helper/li-ion-energy-source-helper.cc.o.d"
+  "CMakeFiles/energy.dir/helper/rv-battery-model-helper.cc.o"
+  "CMakeFiles/energy.dir/helper/rv-battery-model-helper.cc.o.d"
+  "CMakeFiles/energy.dir/model/basic-energy-harvester.cc.o"
+  "CMakeFiles/energy.dir/model/basic-energy-harvester.cc.o.d"
+  "CMakeFiles/energy.dir/model/basic-energy-source.cc.o"
+  "CMakeFiles/energy.dir/model/basic-energy-source.cc.o.d"
+  "CMakeFiles/energy.dir/model/device-energy-model-container.cc.o"
+  "CMakeFiles/energy.dir/model/device-energy-model-container.cc.o.d"
+  "CMakeFiles/energy.dir/model/device-energy-model.cc.o"
+  "CMakeFiles/energy.dir/model/device-energy-model.cc.o.d"
+  "CMakeFiles/energy.dir/model/energy-harvester.cc.o"
+  "CMakeFiles/energy.dir/model/energy-harvester.cc.o.d"
+  "CMakeFiles/energy.dir/model/energy-source.cc.o"
+  "CMakeFiles/energy.dir/model/energy-source.cc.o.d"
+  "CMakeFiles/energy.dir/model/generic-battery-model.cc.o"
+  "CMakeFiles/energy.dir/model/generic-battery-model.cc.o.d"
+  "CMakeFiles/energy.dir/model/li-ion-energy-source.cc.o"
+  "CMakeFiles/energy.dir/model/li-ion-energy-source.cc.o.d"
+  "CMakeFiles/energy.dir/model/rv-battery-model.cc.o"
+  "CMakeFiles/energy.dir/model/rv-battery-model.cc.o.d"
+  "CMakeFiles/energy.dir/model/simple-device-energy-model.cc.o"
+  "CMakeFiles/energy.dir/model/simple-device-energy-model.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/energy.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-flow-monitor-test-default.pdb"
+  "../../out/lib/libns3-dev-flow-monitor-test-default.so"
+  "CMakeFiles/flow-monitor-test.dir/test/flow-monitor-test-suite.cc.o"
+  "CMakeFiles/flow-monitor-test.dir/test/flow-monitor-test-suite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/flow-monitor-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/flow-monitor/helper/flow-monitor-helper.cc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/helper/flow-monitor-helper.cc.o" "gcc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/helper/flow-monitor-helper.cc.o.d"
+  "/root/repo/src/flow-monitor/model/flow-classifier.cc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/flow-classifier.cc.o" "gcc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/flow-classifier.cc.o.d"
+  "/root/repo/src/flow-monitor/model/flow-monitor.cc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/flow-monitor.cc.o" "gcc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/flow-monitor.cc.o.d"
+  "/root/repo/src/flow-monitor/model/flow-probe.cc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/flow-probe.cc.o" "gcc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/flow-probe.cc.o.d"
+  "/root/repo/src/flow-monitor/model/flow-record-writer.cc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/flow-record-writer.cc.o" "gcc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/flow-record-writer.cc.o.d"
+  "/root/repo/src/flow-monitor/model/ipv4-flow-classifier.cc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/ipv4-flow-classifier.cc.o" "gcc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/ipv4-flow-classifier.cc.o.d"
+  "/root/repo/src/flow-monitor/model/ipv4-flow-probe.cc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/ipv4-flow-probe.cc.o" "gcc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/ipv4-flow-probe.cc.o.d"
+  "/root/repo/src/flow-monitor/model/ipv6-flow-classifier.cc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/ipv6-flow-classifier.cc.o" "gcc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/ipv6-flow-classifier.cc.o.d"
+  "/root/repo/src/flow-monitor/model/ipv6-flow-probe.cc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/ipv6-flow-probe.cc.o" "gcc" "src/flow-monitor/CMakeFiles/flow-monitor.dir/model/ipv6-flow-probe.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mtp_build/src/internet/CMakeFiles/internet.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/bridge/CMakeFiles/bridge.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/traffic-control/CMakeFiles/traffic-control.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,27 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-flow-monitor-default.pdb"
+  "../../out/lib/libns3-dev-flow-monitor-default.so"
+  "CMakeFiles/flow-monitor.dir/helper/flow-monitor-helper.cc.o"
+  "CMakeFiles/flow-monitor.dir/helper/flow-monitor-helper.cc.o.d"
+  "CMakeFiles/flow-monitor.dir/model/flow-classifier.cc.o"
+  "CMakeFiles/flow-monitor.dir/model/flow-classifier.cc.o.d"
+  "CMakeFiles/flow-monitor.dir/model/flow-monitor.cc.o"
+  "CMakeFiles/flow-monitor.dir/model/flow-monitor.cc.o.d"
+  "CMakeFiles/flow-monitor.dir/model/flow-probe.cc.o"
+  "CMakeFiles/flow-monitor.dir/model/flow-probe.cc.o.d"
+  "CMakeFiles/flow-monitor.dir/model/flow-record-writer.cc.o"
+  "CMakeFiles/flow-monitor.dir/model/flow-record-writer.cc.o.d"
+  "CMakeFiles/flow-monitor.dir/model/ipv4-flow-classifier.cc.o"
+  "CMakeFiles/flow-monitor.dir/model/ipv4-flow-classifier.cc.o.d"
+  "CMakeFiles/flow-monitor.dir/model/ipv4-flow-probe.cc.o"
+  "CMakeFiles/flow-monitor.dir/model/ipv4-flow-probe.cc.o.d"
+  "CMakeFiles/flow-monitor.dir/model/ipv6-flow-classifier.cc.o"
+  "CMakeFiles/flow-monitor.dir/model/ipv6-flow-classifier.cc.o.d"
+  "CMakeFiles/flow-monitor.dir/model/ipv6-flow-probe.cc.o"
+  "CMakeFiles/flow-monitor.dir/model/ipv6-flow-probe.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/flow-monitor.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,100 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/internet/test/global-route-manager-impl-test-suite.cc" "src/internet/CMakeFiles/internet-test.dir/test/global-route-manager-impl-test-suite.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/global-route-manager-impl-test-suite.cc.o.d"
+  "/root/repo/src/internet/test/icmp-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/icmp-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/icmp-test.cc.o.d"
+  "/root/repo/src/internet/test/internet-stack-helper-test-suite.cc" "src/internet/CMakeFiles/internet-test.dir/test/internet-stack-helper-test-suite.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/internet-stack-helper-test-suite.cc.o.d"
+  "/root/repo/src/internet/test/ipv4-address-generator-test-suite.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-address-generator-test-suite.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-address-generator-test-suite.cc.o.d"
+  "/root/repo/src/internet/test/ipv4-address-helper-test-suite.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-address-helper-test-suite.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-address-helper-test-suite.cc.o.d"
+  "/root/repo/src/internet/test/ipv4-deduplication-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-deduplication-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-deduplication-test.cc.o.d"
+  "/root/repo/src/internet/test/ipv4-forwarding-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-forwarding-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-forwarding-test.cc.o.d"
+  "/root/repo/src/internet/test/ipv4-fragmentation-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-fragmentation-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-fragmentation-test.cc.o.d"
+  "/root/repo/src/internet/test/ipv4-global-routing-test-suite.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-global-routing-test-suite.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-global-routing-test-suite.cc.o.d"
+  "/root/repo/src/internet/test/ipv4-header-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-header-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-header-test.cc.o.d"
+  "/root/repo/src/internet/test/ipv4-list-routing-test-suite.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-list-routing-test-suite.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-list-routing-test-suite.cc.o.d"
+  "/root/repo/src/internet/test/ipv4-packet-info-tag-test-suite.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-packet-info-tag-test-suite.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-packet-info-tag-test-suite.cc.o.d"
+  "/root/repo/src/internet/test/ipv4-raw-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-raw-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-raw-test.cc.o.d"
+  "/root/repo/src/internet/test/ipv4-rip-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-rip-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-rip-test.cc.o.d"
+  "/root/repo/src/internet/test/ipv4-static-routing-test-suite.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-static-routing-test-suite.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-static-routing-test-suite.cc.o.d"
+  "/root/repo/src/internet/test/ipv4-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv4-test.cc.o.d"
+  "/root/repo/src/internet/test/ipv6-address-duplication-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-address-duplication-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-address-duplication-test.cc.o.d"
+  "/root/repo/src/internet/test/ipv6-address-generator-test-suite.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-address-generator-test-suite.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-address-generator-test-suite.cc.o.d"
+  "/root/repo/src/internet/test/ipv6-address-helper-test-suite.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-address-helper-test-suite.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-address-helper-test-suite.cc.o.d"
+  "/root/repo/src/internet/test/ipv6-dual-stack-test-suite.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-dual-stack-test-suite.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-dual-stack-test-suite.cc.o.d"
+  "/root/repo/src/internet/test/ipv6-extension-header-test-suite.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-extension-header-test-suite.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-extension-header-test-suite.cc.o.d"
+  "/root/repo/src/internet/test/ipv6-forwarding-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-forwarding-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-forwarding-test.cc.o.d"
+  "/root/repo/src/internet/test/ipv6-fragmentation-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-fragmentation-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-fragmentation-test.cc.o.d"
+  "/root/repo/src/internet/test/ipv6-list-routing-test-suite.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-list-routing-test-suite.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-list-routing-test-suite.cc.o.d"
+  "/root/repo/src/internet/test/ipv6-packet-info-tag-test-suite.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-packet-info-tag-test-suite.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-packet-info-tag-test-suite.cc.o.d"
+  "/root/repo/src/internet/test/ipv6-raw-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-raw-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-raw-test.cc.o.d"
+  "/root/repo/src/internet/test/ipv6-ripng-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-ripng-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-ripng-test.cc.o.d"
+  "/root/repo/src/internet/test/ipv6-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/ipv6-test.cc.o.d"
+  "/root/repo/src/internet/test/neighbor-cache-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/neighbor-cache-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/neighbor-cache-test.cc.o.d"
+  "/root/repo/src/internet/test/rtt-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/rtt-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/rtt-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-advertised-window-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-advertised-window-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-advertised-window-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-bbr-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-bbr-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-bbr-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-bic-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-bic-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-bic-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-bytes-in-flight-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-bytes-in-flight-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-bytes-in-flight-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-classic-recovery-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-classic-recovery-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-classic-recovery-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-close-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-close-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-close-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-cong-avoid-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-cong-avoid-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-cong-avoid-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-datasentcb-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-datasentcb-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-datasentcb-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-dctcp-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-dctcp-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-dctcp-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-ecn-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-ecn-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-ecn-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-endpoint-bug2211.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-endpoint-bug2211.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-endpoint-bug2211.cc.o.d"
+  "/root/repo/src/internet/test/tcp-error-model.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-error-model.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-error-model.cc.o.d"
+  "/root/repo/src/internet/test/tcp-fast-retr-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-fast-retr-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-fast-retr-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-general-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-general-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-general-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-gso-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-gso-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-gso-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-header-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-header-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-header-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-highspeed-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-highspeed-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-highspeed-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-htcp-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-htcp-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-htcp-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-hybla-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-hybla-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-hybla-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-illinois-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-illinois-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-illinois-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-ledbat-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-ledbat-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-ledbat-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-linux-reno-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-linux-reno-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-linux-reno-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-loss-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-loss-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-loss-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-lp-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-lp-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-lp-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-option-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-option-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-option-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-pacing-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-pacing-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-pacing-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-pkts-acked-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-pkts-acked-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-pkts-acked-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-prr-recovery-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-prr-recovery-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-prr-recovery-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-rate-ops-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-rate-ops-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-rate-ops-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-rto-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-rto-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-rto-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-rtt-estimation.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-rtt-estimation.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-rtt-estimation.cc.o.d"
+  "/root/repo/src/internet/test/tcp-rx-batch-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-rx-batch-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-rx-batch-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-rx-buffer-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-rx-buffer-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-rx-buffer-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-sack-permitted-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-sack-permitted-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-sack-permitted-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-scalable-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-scalable-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-scalable-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-slow-start-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-slow-start-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-slow-start-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-syn-connection-failed-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-syn-connection-failed-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-syn-connection-failed-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-timestamp-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-timestamp-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-timestamp-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-tx-buffer-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-tx-buffer-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-tx-buffer-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-vegas-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-vegas-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-vegas-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-veno-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-veno-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-veno-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-wscaling-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-wscaling-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-wscaling-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-yeah-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-yeah-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-yeah-test.cc.o.d"
+  "/root/repo/src/internet/test/tcp-zero-window-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-zero-window-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/tcp-zero-window-test.cc.o.d"
+  "/root/repo/src/internet/test/udp-test.cc" "src/internet/CMakeFiles/internet-test.dir/test/udp-test.cc.o" "gcc" "src/internet/CMakeFiles/internet-test.dir/test/udp-test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mtp_build/src/internet/CMakeFiles/internet.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/bridge/CMakeFiles/bridge.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/traffic-control/CMakeFiles/traffic-control.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,150 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/internet/helper/internet-stack-helper.cc" "src/internet/CMakeFiles/internet.dir/helper/internet-stack-helper.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/internet-stack-helper.cc.o.d"
+  "/root/repo/src/internet/helper/internet-trace-helper.cc" "src/internet/CMakeFiles/internet.dir/helper/internet-trace-helper.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/internet-trace-helper.cc.o.d"
+  "/root/repo/src/internet/helper/ipv4-address-helper.cc" "src/internet/CMakeFiles/internet.dir/helper/ipv4-address-helper.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/ipv4-address-helper.cc.o.d"
+  "/root/repo/src/internet/helper/ipv4-global-routing-helper.cc" "src/internet/CMakeFiles/internet.dir/helper/ipv4-global-routing-helper.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/ipv4-global-routing-helper.cc.o.d"
+  "/root/repo/src/internet/helper/ipv4-interface-container.cc" "src/internet/CMakeFiles/internet.dir/helper/ipv4-interface-container.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/ipv4-interface-container.cc.o.d"
+  "/root/repo/src/internet/helper/ipv4-list-routing-helper.cc" "src/internet/CMakeFiles/internet.dir/helper/ipv4-list-routing-helper.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/ipv4-list-routing-helper.cc.o.d"
+  "/root/repo/src/internet/helper/ipv4-routing-helper.cc" "src/internet/CMakeFiles/internet.dir/helper/ipv4-routing-helper.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/ipv4-routing-helper.cc.o.d"
+  "/root/repo/src/internet/helper/ipv4-static-routing-helper.cc" "src/internet/CMakeFiles/internet.dir/helper/ipv4-static-routing-helper.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/ipv4-static-routing-helper.cc.o.d"
+  "/root/repo/src/internet/helper/ipv6-address-helper.cc" "src/internet/CMakeFiles/internet.dir/helper/ipv6-address-helper.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/ipv6-address-helper.cc.o.d"
+  "/root/repo/src/internet/helper/ipv6-interface-container.cc" "src/internet/CMakeFiles/internet.dir/helper/ipv6-interface-container.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/ipv6-interface-container.cc.o.d"
+  "/root/repo/src/internet/helper/ipv6-list-routing-helper.cc" "src/internet/CMakeFiles/internet.dir/helper/ipv6-list-routing-helper.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/ipv6-list-routing-helper.cc.o.d"
+  "/root/repo/src/internet/helper/ipv6-routing-helper.cc" "src/internet/CMakeFiles/internet.dir/helper/ipv6-routing-helper.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/ipv6-routing-helper.cc.o.d"
+  "/root/repo/src/internet/helper/ipv6-static-routing-helper.cc" "src/internet/CMakeFiles/internet.dir/helper/ipv6-static-routing-helper.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/ipv6-static-routing-helper.cc.o.d"
+  "/root/repo/src/internet/helper/neighbor-cache-helper.cc" "src/internet/CMakeFiles/internet.dir/helper/neighbor-cache-helper.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/neighbor-cache-helper.cc.o.d"
+  "/root/repo/src/internet/helper/rip-helper.cc" "src/internet/CMakeFiles/internet.dir/helper/rip-helper.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/rip-helper.cc.o.d"
+  "/root/repo/src/internet/helper/ripng-helper.cc" "src/internet/CMakeFiles/internet.dir/helper/ripng-helper.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/helper/ripng-helper.cc.o.d"
+  "/root/repo/src/internet/model/arp-cache.cc" "src/internet/CMakeFiles/internet.dir/model/arp-cache.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/arp-cache.cc.o.d"
+  "/root/repo/src/internet/model/arp-header.cc" "src/internet/CMakeFiles/internet.dir/model/arp-header.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/arp-header.cc.o.d"
+  "/root/repo/src/internet/model/arp-l3-protocol.cc" "src/internet/CMakeFiles/internet.dir/model/arp-l3-protocol.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/arp-l3-protocol.cc.o.d"
+  "/root/repo/src/internet/model/arp-queue-disc-item.cc" "src/internet/CMakeFiles/internet.dir/model/arp-queue-disc-item.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/arp-queue-disc-item.cc.o.d"
+  "/root/repo/src/internet/model/candidate-queue.cc" "src/internet/CMakeFiles/internet.dir/model/candidate-queue.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/candidate-queue.cc.o.d"
+  "/root/repo/src/internet/model/global-route-manager-impl.cc" "src/internet/CMakeFiles/internet.dir/model/global-route-manager-impl.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/global-route-manager-impl.cc.o.d"
+  "/root/repo/src/internet/model/global-route-manager.cc" "src/internet/CMakeFiles/internet.dir/model/global-route-manager.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/global-route-manager.cc.o.d"
+  "/root/repo/src/internet/model/global-router-interface.cc" "src/internet/CMakeFiles/internet.dir/model/global-router-interface.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/global-router-interface.cc.o.d"
+  "/root/repo/src/internet/model/icmpv4-l4-protocol.cc" "src/internet/CMakeFiles/internet.dir/model/icmpv4-l4-protocol.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/icmpv4-l4-protocol.cc.o.d"
+  "/root/repo/src/internet/model/icmpv4.cc" "src/internet/CMakeFiles/internet.dir/model/icmpv4.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/icmpv4.cc.o.d"
+  "/root/repo/src/internet/model/icmpv6-header.cc" "src/internet/CMakeFiles/internet.dir/model/icmpv6-header.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/icmpv6-header.cc.o.d"
+  "/root/repo/src/internet/model/icmpv6-l4-protocol.cc" "src/internet/CMakeFiles/internet.dir/model/icmpv6-l4-protocol.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/icmpv6-l4-protocol.cc.o.d"
+  "/root/repo/src/internet/model/ip-l4-protocol.cc" "src/internet/CMakeFiles/internet.dir/model/ip-l4-protocol.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ip-l4-protocol.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-address-generator.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-address-generator.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-address-generator.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-end-point-demux.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-end-point-demux.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-end-point-demux.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-end-point.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-end-point.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-end-point.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-global-routing.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-global-routing.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-global-routing.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-header.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-header.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-header.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-interface-address.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-interface-address.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-interface-address.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-interface.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-interface.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-interface.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-l3-protocol.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-l3-protocol.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-l3-protocol.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-list-routing.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-list-routing.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-list-routing.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-packet-filter.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-packet-filter.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-packet-filter.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-packet-info-tag.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-packet-info-tag.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-packet-info-tag.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-packet-probe.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-packet-probe.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-packet-probe.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-queue-disc-item.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-queue-disc-item.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-queue-disc-item.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-raw-socket-factory-impl.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-raw-socket-factory-impl.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-raw-socket-factory-impl.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-raw-socket-factory.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-raw-socket-factory.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-raw-socket-factory.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-raw-socket-impl.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-raw-socket-impl.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-raw-socket-impl.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-route.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-route.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-route.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-routing-protocol.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-routing-protocol.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-routing-protocol.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-routing-table-entry.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-routing-table-entry.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-routing-table-entry.cc.o.d"
+  "/root/repo/src/internet/model/ipv4-static-routing.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4-static-routing.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4-static-routing.cc.o.d"
+  "/root/repo/src/internet/model/ipv4.cc" "src/internet/CMakeFiles/internet.dir/model/ipv4.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv4.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-address-generator.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-address-generator.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-address-generator.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-autoconfigured-prefix.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-autoconfigured-prefix.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-autoconfigured-prefix.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-end-point-demux.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-end-point-demux.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-end-point-demux.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-end-point.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-end-point.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-end-point.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-extension-demux.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-extension-demux.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-extension-demux.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-extension-header.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-extension-header.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-extension-header.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-extension.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-extension.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-extension.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-header.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-header.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-header.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-interface-address.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-interface-address.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-interface-address.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-interface.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-interface.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-interface.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-l3-protocol.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-l3-protocol.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-l3-protocol.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-list-routing.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-list-routing.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-list-routing.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-option-demux.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-option-demux.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-option-demux.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-option-header.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-option-header.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-option-header.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-option.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-option.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-option.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-packet-filter.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-packet-filter.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-packet-filter.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-packet-info-tag.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-packet-info-tag.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-packet-info-tag.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-packet-probe.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-packet-probe.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-packet-probe.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-pmtu-cache.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-pmtu-cache.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-pmtu-cache.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-queue-disc-item.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-queue-disc-item.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-queue-disc-item.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-raw-socket-factory-impl.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-raw-socket-factory-impl.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-raw-socket-factory-impl.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-raw-socket-factory.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-raw-socket-factory.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-raw-socket-factory.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-raw-socket-impl.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-raw-socket-impl.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-raw-socket-impl.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-route.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-route.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-route.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-routing-protocol.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-routing-protocol.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-routing-protocol.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-routing-table-entry.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-routing-table-entry.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-routing-table-entry.cc.o.d"
+  "/root/repo/src/internet/model/ipv6-static-routing.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6-static-routing.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6-static-routing.cc.o.d"
+  "/root/repo/src/internet/model/ipv6.cc" "src/internet/CMakeFiles/internet.dir/model/ipv6.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ipv6.cc.o.d"
+  "/root/repo/src/internet/model/loopback-net-device.cc" "src/internet/CMakeFiles/internet.dir/model/loopback-net-device.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/loopback-net-device.cc.o.d"
+  "/root/repo/src/internet/model/ndisc-cache.cc" "src/internet/CMakeFiles/internet.dir/model/ndisc-cache.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ndisc-cache.cc.o.d"
+  "/root/repo/src/internet/model/rip-header.cc" "src/internet/CMakeFiles/internet.dir/model/rip-header.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/rip-header.cc.o.d"
+  "/root/repo/src/internet/model/rip.cc" "src/internet/CMakeFiles/internet.dir/model/rip.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/rip.cc.o.d"
+  "/root/repo/src/internet/model/ripng-header.cc" "src/internet/CMakeFiles/internet.dir/model/ripng-header.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ripng-header.cc.o.d"
+  "/root/repo/src/internet/model/ripng.cc" "src/internet/CMakeFiles/internet.dir/model/ripng.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/ripng.cc.o.d"
+  "/root/repo/src/internet/model/rtt-estimator.cc" "src/internet/CMakeFiles/internet.dir/model/rtt-estimator.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/rtt-estimator.cc.o.d"
+  "/root/repo/src/internet/model/tcp-bbr.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-bbr.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-bbr.cc.o.d"
+  "/root/repo/src/internet/model/tcp-bic.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-bic.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-bic.cc.o.d"
+  "/root/repo/src/internet/model/tcp-congestion-ops.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-congestion-ops.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-congestion-ops.cc.o.d"
+  "/root/repo/src/internet/model/tcp-cubic.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-cubic.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-cubic.cc.o.d"
+  "/root/repo/src/internet/model/tcp-dctcp.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-dctcp.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-dctcp.cc.o.d"
+  "/root/repo/src/internet/model/tcp-header.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-header.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-header.cc.o.d"
+  "/root/repo/src/internet/model/tcp-highspeed.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-highspeed.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-highspeed.cc.o.d"
+  "/root/repo/src/internet/model/tcp-htcp.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-htcp.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-htcp.cc.o.d"
+  "/root/repo/src/internet/model/tcp-hybla.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-hybla.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-hybla.cc.o.d"
+  "/root/repo/src/internet/model/tcp-illinois.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-illinois.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-illinois.cc.o.d"
+  "/root/repo/src/internet/model/tcp-l4-protocol.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-l4-protocol.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-l4-protocol.cc.o.d"
+  "/root/repo/src/internet/model/tcp-ledbat.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-ledbat.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-ledbat.cc.o.d"
+  "/root/repo/src/internet/model/tcp-linux-reno.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-linux-reno.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-linux-reno.cc.o.d"
+  "/root/repo/src/internet/model/tcp-lp.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-lp.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-lp.cc.o.d"
+  "/root/repo/src/internet/model/tcp-option-rfc793.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-option-rfc793.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-option-rfc793.cc.o.d"
+  "/root/repo/src/internet/model/tcp-option-sack-permitted.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-option-sack-permitted.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-option-sack-permitted.cc.o.d"
+  "/root/repo/src/internet/model/tcp-option-sack.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-option-sack.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-option-sack.cc.o.d"
+  "/root/repo/src/internet/model/tcp-option-ts.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-option-ts.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-option-ts.cc.o.d"
+  "/root/repo/src/internet/model/tcp-option-winscale.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-option-winscale.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-option-winscale.cc.o.d"
+  "/root/repo/src/internet/model/tcp-option.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-option.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-option.cc.o.d"
+  "/root/repo/src/internet/model/tcp-prr-recovery.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-prr-recovery.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-prr-recovery.cc.o.d"
+  "/root/repo/src/internet/model/tcp-rate-ops.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-rate-ops.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-rate-ops.cc.o.d"
+  "/root/repo/src/internet/model/tcp-recovery-ops.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-recovery-ops.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-recovery-ops.cc.o.d"
+  "/root/repo/src/internet/model/tcp-rx-buffer.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-rx-buffer.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-rx-buffer.cc.o.d"
+  "/root/repo/src/internet/model/tcp-scalable.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-scalable.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-scalable.cc.o.d"
+  "/root/repo/src/internet/model/tcp-socket-base.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-socket-base.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-socket-base.cc.o.d"
+  "/root/repo/src/internet/model/tcp-socket-factory-impl.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-socket-factory-impl.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-socket-factory-impl.cc.o.d"
+  "/root/repo/src/internet/model/tcp-socket-factory.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-socket-factory.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-socket-factory.cc.o.d"
+  "/root/repo/src/internet/model/tcp-socket-state.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-socket-state.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-socket-state.cc.o.d"
+  "/root/repo/src/internet/model/tcp-socket.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-socket.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-socket.cc.o.d"
+  "/root/repo/src/internet/model/tcp-tx-buffer.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-tx-buffer.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-tx-buffer.cc.o.d"
+  "/root/repo/src/internet/model/tcp-tx-item.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-tx-item.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-tx-item.cc.o.d"
+  "/root/repo/src/internet/model/tcp-vegas.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-vegas.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-vegas.cc.o.d"
+  "/root/repo/src/internet/model/tcp-veno.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-veno.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-veno.cc.o.d"
+  "/root/repo/src/internet/model/tcp-westwood-plus.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-westwood-plus.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-westwood-plus.cc.o.d"
+  "/root/repo/src/internet/model/tcp-yeah.cc" "src/internet/CMakeFiles/internet.dir/model/tcp-yeah.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/tcp-yeah.cc.o.d"
+  "/root/repo/src/internet/model/udp-header.cc" "src/internet/CMakeFiles/internet.dir/model/udp-header.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/udp-header.cc.o.d"
+  "/root/repo/src/internet/model/udp-l4-protocol.cc" "src/internet/CMakeFiles/internet.dir/model/udp-l4-protocol.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/udp-l4-protocol.cc.o.d"
+  "/root/repo/src/internet/model/udp-socket-factory-impl.cc" "src/internet/CMakeFiles/internet.dir/model/udp-socket-factory-impl.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/udp-socket-factory-impl.cc.o.d"
+  "/root/repo/src/internet/model/udp-socket-factory.cc" "src/internet/CMakeFiles/internet.dir/model/udp-socket-factory.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/udp-socket-factory.cc.o.d"
+  "/root/repo/src/internet/model/udp-socket-impl.cc" "src/internet/CMakeFiles/internet.dir/model/udp-socket-impl.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/udp-socket-impl.cc.o.d"
+  "/root/repo/src/internet/model/udp-socket.cc" "src/internet/CMakeFiles/internet.dir/model/udp-socket.cc.o" "gcc" "src/internet/CMakeFiles/internet.dir/model/udp-socket.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mtp_build/src/bridge/CMakeFiles/bridge.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/traffic-control/CMakeFiles/traffic-control.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
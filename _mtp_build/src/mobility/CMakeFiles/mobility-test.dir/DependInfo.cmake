@@ -0,0 +1,34 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/mobility/test/box-line-intersection-test.cc" "src/mobility/CMakeFiles/mobility-test.dir/test/box-line-intersection-test.cc.o" "gcc" "src/mobility/CMakeFiles/mobility-test.dir/test/box-line-intersection-test.cc.o.d"
+  "/root/repo/src/mobility/test/geo-to-cartesian-test.cc" "src/mobility/CMakeFiles/mobility-test.dir/test/geo-to-cartesian-test.cc.o" "gcc" "src/mobility/CMakeFiles/mobility-test.dir/test/geo-to-cartesian-test.cc.o.d"
+  "/root/repo/src/mobility/test/geocentric-topocentric-conversion-test.cc" "src/mobility/CMakeFiles/mobility-test.dir/test/geocentric-topocentric-conversion-test.cc.o" "gcc" "src/mobility/CMakeFiles/mobility-test.dir/test/geocentric-topocentric-conversion-test.cc.o.d"
+  "/root/repo/src/mobility/test/mobility-grid-test.cc" "src/mobility/CMakeFiles/mobility-test.dir/test/mobility-grid-test.cc.o" "gcc" "src/mobility/CMakeFiles/mobility-test.dir/test/mobility-grid-test.cc.o.d"
+  "/root/repo/src/mobility/test/mobility-test-suite.cc" "src/mobility/CMakeFiles/mobility-test.dir/test/mobility-test-suite.cc.o" "gcc" "src/mobility/CMakeFiles/mobility-test.dir/test/mobility-test-suite.cc.o.d"
+  "/root/repo/src/mobility/test/mobility-trace-test-suite.cc" "src/mobility/CMakeFiles/mobility-test.dir/test/mobility-trace-test-suite.cc.o" "gcc" "src/mobility/CMakeFiles/mobility-test.dir/test/mobility-trace-test-suite.cc.o.d"
+  "/root/repo/src/mobility/test/ns2-mobility-helper-test-suite.cc" "src/mobility/CMakeFiles/mobility-test.dir/test/ns2-mobility-helper-test-suite.cc.o" "gcc" "src/mobility/CMakeFiles/mobility-test.dir/test/ns2-mobility-helper-test-suite.cc.o.d"
+  "/root/repo/src/mobility/test/rand-cart-around-geo-test.cc" "src/mobility/CMakeFiles/mobility-test.dir/test/rand-cart-around-geo-test.cc.o" "gcc" "src/mobility/CMakeFiles/mobility-test.dir/test/rand-cart-around-geo-test.cc.o.d"
+  "/root/repo/src/mobility/test/rectangle-closest-border-test.cc" "src/mobility/CMakeFiles/mobility-test.dir/test/rectangle-closest-border-test.cc.o" "gcc" "src/mobility/CMakeFiles/mobility-test.dir/test/rectangle-closest-border-test.cc.o.d"
+  "/root/repo/src/mobility/test/steady-state-random-waypoint-mobility-model-test.cc" "src/mobility/CMakeFiles/mobility-test.dir/test/steady-state-random-waypoint-mobility-model-test.cc.o" "gcc" "src/mobility/CMakeFiles/mobility-test.dir/test/steady-state-random-waypoint-mobility-model-test.cc.o.d"
+  "/root/repo/src/mobility/test/waypoint-mobility-model-test.cc" "src/mobility/CMakeFiles/mobility-test.dir/test/waypoint-mobility-model-test.cc.o" "gcc" "src/mobility/CMakeFiles/mobility-test.dir/test/waypoint-mobility-model-test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mtp_build/src/mobility/CMakeFiles/mobility.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/antenna/CMakeFiles/antenna.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
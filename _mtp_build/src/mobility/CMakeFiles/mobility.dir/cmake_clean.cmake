@@ -0,0 +1,53 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-mobility-default.pdb"
+  "../../out/lib/libns3-dev-mobility-default.so"
+  "CMakeFiles/mobility.dir/helper/group-mobility-helper.cc.o"
+  "CMakeFiles/mobility.dir/helper/group-mobility-helper.cc.o.d"
+  "CMakeFiles/mobility.dir/helper/mobility-helper.cc.o"
+  "CMakeFiles/mobility.dir/helper/mobility-helper.cc.o.d"
+  "CMakeFiles/mobility.dir/helper/ns2-mobility-helper.cc.o"
+  "CMakeFiles/mobility.dir/helper/ns2-mobility-helper.cc.o.d"
+  "CMakeFiles/mobility.dir/model/box.cc.o"
+  "CMakeFiles/mobility.dir/model/box.cc.o.d"
+  "CMakeFiles/mobility.dir/model/constant-acceleration-mobility-model.cc.o"
+  "CMakeFiles/mobility.dir/model/constant-acceleration-mobility-model.cc.o.d"
+  "CMakeFiles/mobility.dir/model/constant-position-mobility-model.cc.o"
+  "CMakeFiles/mobility.dir/model/constant-position-mobility-model.cc.o.d"
+  "CMakeFiles/mobility.dir/model/constant-velocity-helper.cc.o"
+  "CMakeFiles/mobility.dir/model/constant-velocity-helper.cc.o.d"
+  "CMakeFiles/mobility.dir/model/constant-velocity-mobility-model.cc.o"
+  "CMakeFiles/mobility.dir/model/constant-velocity-mobility-model.cc.o.d"
+  "CMakeFiles/mobility.dir/model/gauss-markov-mobility-model.cc.o"
+  "CMakeFiles/mobility.dir/model/gauss-markov-mobility-model.cc.o.d"
+  "CMakeFiles/mobility.dir/model/geocentric-constant-position-mobility-model.cc.o"
+  "CMakeFiles/mobility.dir/model/geocentric-constant-position-mobility-model.cc.o.d"
+  "CMakeFiles/mobility.dir/model/geographic-positions.cc.o"
+  "CMakeFiles/mobility.dir/model/geographic-positions.cc.o.d"
+  "CMakeFiles/mobility.dir/model/hierarchical-mobility-model.cc.o"
+  "CMakeFiles/mobility.dir/model/hierarchical-mobility-model.cc.o.d"
+  "CMakeFiles/mobility.dir/model/mobility-grid.cc.o"
+  "CMakeFiles/mobility.dir/model/mobility-grid.cc.o.d"
+  "CMakeFiles/mobility.dir/model/mobility-model.cc.o"
+  "CMakeFiles/mobility.dir/model/mobility-model.cc.o.d"
+  "CMakeFiles/mobility.dir/model/position-allocator.cc.o"
+  "CMakeFiles/mobility.dir/model/position-allocator.cc.o.d"
+  "CMakeFiles/mobility.dir/model/random-direction-2d-mobility-model.cc.o"
+  "CMakeFiles/mobility.dir/model/random-direction-2d-mobility-model.cc.o.d"
+  "CMakeFiles/mobility.dir/model/random-walk-2d-mobility-model.cc.o"
+  "CMakeFiles/mobility.dir/model/random-walk-2d-mobility-model.cc.o.d"
+  "CMakeFiles/mobility.dir/model/random-waypoint-mobility-model.cc.o"
+  "CMakeFiles/mobility.dir/model/random-waypoint-mobility-model.cc.o.d"
+  "CMakeFiles/mobility.dir/model/rectangle.cc.o"
+  "CMakeFiles/mobility.dir/model/rectangle.cc.o.d"
+  "CMakeFiles/mobility.dir/model/steady-state-random-waypoint-mobility-model.cc.o"
+  "CMakeFiles/mobility.dir/model/steady-state-random-waypoint-mobility-model.cc.o.d"
+  "CMakeFiles/mobility.dir/model/waypoint-mobility-model.cc.o"
+  "CMakeFiles/mobility.dir/model/waypoint-mobility-model.cc.o.d"
+  "CMakeFiles/mobility.dir/model/waypoint.cc.o"
+  "CMakeFiles/mobility.dir/model/waypoint.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mobility.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-mtp-test-default.pdb"
+  "../../out/lib/libns3-dev-mtp-test-default.so"
+  "CMakeFiles/mtp-test.dir/test/mtp-test-suite.cc.o"
+  "CMakeFiles/mtp-test.dir/test/mtp-test-suite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mtp-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/mtp/model/logical-process.cc" "src/mtp/CMakeFiles/mtp.dir/model/logical-process.cc.o" "gcc" "src/mtp/CMakeFiles/mtp.dir/model/logical-process.cc.o.d"
+  "/root/repo/src/mtp/model/multithreaded-simulator-impl.cc" "src/mtp/CMakeFiles/mtp.dir/model/multithreaded-simulator-impl.cc.o" "gcc" "src/mtp/CMakeFiles/mtp.dir/model/multithreaded-simulator-impl.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mtp_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-mtp-default.pdb"
+  "../../out/lib/libns3-dev-mtp-default.so"
+  "CMakeFiles/mtp.dir/model/logical-process.cc.o"
+  "CMakeFiles/mtp.dir/model/logical-process.cc.o.d"
+  "CMakeFiles/mtp.dir/model/multithreaded-simulator-impl.cc.o"
+  "CMakeFiles/mtp.dir/model/multithreaded-simulator-impl.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/mtp.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,154 @@
+# Install script for directory: /root/repo/src/network
+
+# Set the install prefix
+if(NOT DEFINED CMAKE_INSTALL_PREFIX)
+  set(CMAKE_INSTALL_PREFIX "/usr/local")
+endif()
+string(REGEX REPLACE "/$" "" CMAKE_INSTALL_PREFIX "${CMAKE_INSTALL_PREFIX}")
+
+# Set the install configuration name.
+if(NOT DEFINED CMAKE_INSTALL_CONFIG_NAME)
+  if(BUILD_TYPE)
+    string(REGEX REPLACE "^[^A-Za-z0-9_]+" ""
+           CMAKE_INSTALL_CONFIG_NAME "${BUILD_TYPE}")
+  else()
+    set(CMAKE_INSTALL_CONFIG_NAME "default")
+  endif()
+  message(STATUS "Install configuration: \"${CMAKE_INSTALL_CONFIG_NAME}\"")
+endif()
+
+# Set the component getting installed.
+if(NOT CMAKE_INSTALL_COMPONENT)
+  if(COMPONENT)
+    message(STATUS "Install component: \"${COMPONENT}\"")
+    set(CMAKE_INSTALL_COMPONENT "${COMPONENT}")
+  else()
+    set(CMAKE_INSTALL_COMPONENT)
+  endif()
+endif()
+
+# Install shared libraries without execute permission?
+if(NOT DEFINED CMAKE_INSTALL_SO_NO_EXE)
+  set(CMAKE_INSTALL_SO_NO_EXE "1")
+endif()
+
+# Is this installation the result of a crosscompile?
+if(NOT DEFINED CMAKE_CROSSCOMPILING)
+  set(CMAKE_CROSSCOMPILING "FALSE")
+endif()
+
+# Set default install directory permissions.
+if(NOT DEFINED CMAKE_OBJDUMP)
+  set(CMAKE_OBJDUMP "/usr/bin/objdump")
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-network-default.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-network-default.so")
+    file(RPATH_CHECK
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-network-default.so"
+         RPATH "/usr/local/lib:$ORIGIN/:$ORIGIN/../lib:/usr/local/lib64:$ORIGIN/:$ORIGIN/../lib64")
+  endif()
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/lib" TYPE SHARED_LIBRARY FILES "/root/repo/_mtp_build/out/lib/libns3-dev-network-default.so")
+  if(EXISTS "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-network-default.so" AND
+     NOT IS_SYMLINK "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-network-default.so")
+    file(RPATH_CHANGE
+         FILE "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-network-default.so"
+         OLD_RPATH "/root/repo/_mtp_build/out/lib::::::::::::::::::::::::::::::::::::::::::::::::::::"
+         NEW_RPATH "/usr/local/lib:$ORIGIN/:$ORIGIN/../lib:/usr/local/lib64:$ORIGIN/:$ORIGIN/../lib64")
+    if(CMAKE_INSTALL_DO_STRIP)
+      execute_process(COMMAND "/usr/bin/strip" "$ENV{DESTDIR}${CMAKE_INSTALL_PREFIX}/lib/libns3-dev-network-default.so")
+    endif()
+  endif()
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+endif()
+
+if(CMAKE_INSTALL_COMPONENT STREQUAL "Unspecified" OR NOT CMAKE_INSTALL_COMPONENT)
+  file(INSTALL DESTINATION "${CMAKE_INSTALL_PREFIX}/include/ns3" TYPE FILE FILES
+    "/root/repo/src/network/helper/application-container.h"
+    "/root/repo/src/network/helper/application-helper.h"
+    "/root/repo/src/network/helper/delay-jitter-estimation.h"
+    "/root/repo/src/network/helper/net-device-container.h"
+    "/root/repo/src/network/helper/node-container.h"
+    "/root/repo/src/network/helper/packet-socket-helper.h"
+    "/root/repo/src/network/helper/simple-net-device-helper.h"
+    "/root/repo/src/network/helper/trace-helper.h"
+    "/root/repo/src/network/model/address.h"
+    "/root/repo/src/network/model/application.h"
+    "/root/repo/src/network/model/buffer.h"
+    "/root/repo/src/network/model/byte-tag-list.h"
+    "/root/repo/src/network/model/channel-list.h"
+    "/root/repo/src/network/model/channel.h"
+    "/root/repo/src/network/model/chunk.h"
+    "/root/repo/src/network/model/header.h"
+    "/root/repo/src/network/model/net-device.h"
+    "/root/repo/src/network/model/nix-vector.h"
+    "/root/repo/src/network/model/node-list.h"
+    "/root/repo/src/network/model/node.h"
+    "/root/repo/src/network/model/packet-metadata.h"
+    "/root/repo/src/network/model/packet-tag-list.h"
+    "/root/repo/src/network/model/packet.h"
+    "/root/repo/src/network/model/socket-factory.h"
+    "/root/repo/src/network/model/socket.h"
+    "/root/repo/src/network/model/tag-buffer.h"
+    "/root/repo/src/network/model/tag.h"
+    "/root/repo/src/network/model/trailer.h"
+    "/root/repo/src/network/test/header-serialization-test.h"
+    "/root/repo/src/network/utils/address-utils.h"
+    "/root/repo/src/network/utils/binary-ascii-trace.h"
+    "/root/repo/src/network/utils/bit-deserializer.h"
+    "/root/repo/src/network/utils/bit-serializer.h"
+    "/root/repo/src/network/utils/crc32.h"
+    "/root/repo/src/network/utils/data-rate.h"
+    "/root/repo/src/network/utils/drop-tail-queue.h"
+    "/root/repo/src/network/utils/dynamic-queue-limits.h"
+    "/root/repo/src/network/utils/error-channel.h"
+    "/root/repo/src/network/utils/error-model.h"
+    "/root/repo/src/network/utils/ethernet-header.h"
+    "/root/repo/src/network/utils/ethernet-trailer.h"
+    "/root/repo/src/network/utils/flow-id-tag.h"
+    "/root/repo/src/network/utils/generic-phy.h"
+    "/root/repo/src/network/utils/gso-tag.h"
+    "/root/repo/src/network/utils/inet-socket-address.h"
+    "/root/repo/src/network/utils/inet6-socket-address.h"
+    "/root/repo/src/network/utils/ipv4-address.h"
+    "/root/repo/src/network/utils/ipv6-address.h"
+    "/root/repo/src/network/utils/llc-snap-header.h"
+    "/root/repo/src/network/utils/lollipop-counter.h"
+    "/root/repo/src/network/utils/mac16-address.h"
+    "/root/repo/src/network/utils/mac48-address.h"
+    "/root/repo/src/network/utils/mac64-address.h"
+    "/root/repo/src/network/utils/mac8-address.h"
+    "/root/repo/src/network/utils/net-device-queue-interface.h"
+    "/root/repo/src/network/utils/output-stream-wrapper.h"
+    "/root/repo/src/network/utils/packet-burst.h"
+    "/root/repo/src/network/utils/packet-data-calculators.h"
+    "/root/repo/src/network/utils/packet-probe.h"
+    "/root/repo/src/network/utils/packet-socket-address.h"
+    "/root/repo/src/network/utils/packet-socket-client.h"
+    "/root/repo/src/network/utils/packet-socket-factory.h"
+    "/root/repo/src/network/utils/packet-socket-server.h"
+    "/root/repo/src/network/utils/packet-socket.h"
+    "/root/repo/src/network/utils/packetbb.h"
+    "/root/repo/src/network/utils/pcap-file-wrapper.h"
+    "/root/repo/src/network/utils/pcap-file.h"
+    "/root/repo/src/network/utils/pcap-test.h"
+    "/root/repo/src/network/utils/pcap-write-buffer.h"
+    "/root/repo/src/network/utils/pcapng-file.h"
+    "/root/repo/src/network/utils/queue-fwd.h"
+    "/root/repo/src/network/utils/queue-item.h"
+    "/root/repo/src/network/utils/queue-limits.h"
+    "/root/repo/src/network/utils/queue-size.h"
+    "/root/repo/src/network/utils/queue.h"
+    "/root/repo/src/network/utils/radiotap-header.h"
+    "/root/repo/src/network/utils/sequence-number.h"
+    "/root/repo/src/network/utils/simple-channel.h"
+    "/root/repo/src/network/utils/simple-net-device.h"
+    "/root/repo/src/network/utils/sll-header.h"
+    "/root/repo/src/network/utils/timestamp-tag.h"
+    "/root/repo/_mtp_build/out/include/ns3/network-module.h"
+    )
+endif()
+
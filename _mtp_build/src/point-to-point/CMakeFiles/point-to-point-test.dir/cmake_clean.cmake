@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-point-to-point-test-default.pdb"
+  "../../out/lib/libns3-dev-point-to-point-test-default.so"
+  "CMakeFiles/point-to-point-test.dir/test/point-to-point-test.cc.o"
+  "CMakeFiles/point-to-point-test.dir/test/point-to-point-test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/point-to-point-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,25 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/point-to-point/helper/point-to-point-helper.cc" "src/point-to-point/CMakeFiles/point-to-point.dir/helper/point-to-point-helper.cc.o" "gcc" "src/point-to-point/CMakeFiles/point-to-point.dir/helper/point-to-point-helper.cc.o.d"
+  "/root/repo/src/point-to-point/model/point-to-point-channel.cc" "src/point-to-point/CMakeFiles/point-to-point.dir/model/point-to-point-channel.cc.o" "gcc" "src/point-to-point/CMakeFiles/point-to-point.dir/model/point-to-point-channel.cc.o.d"
+  "/root/repo/src/point-to-point/model/point-to-point-net-device.cc" "src/point-to-point/CMakeFiles/point-to-point.dir/model/point-to-point-net-device.cc.o" "gcc" "src/point-to-point/CMakeFiles/point-to-point.dir/model/point-to-point-net-device.cc.o.d"
+  "/root/repo/src/point-to-point/model/ppp-header.cc" "src/point-to-point/CMakeFiles/point-to-point.dir/model/ppp-header.cc.o" "gcc" "src/point-to-point/CMakeFiles/point-to-point.dir/model/ppp-header.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mtp_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
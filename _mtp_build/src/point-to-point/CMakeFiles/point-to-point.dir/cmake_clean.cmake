@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-point-to-point-default.pdb"
+  "../../out/lib/libns3-dev-point-to-point-default.so"
+  "CMakeFiles/point-to-point.dir/helper/point-to-point-helper.cc.o"
+  "CMakeFiles/point-to-point.dir/helper/point-to-point-helper.cc.o.d"
+  "CMakeFiles/point-to-point.dir/model/point-to-point-channel.cc.o"
+  "CMakeFiles/point-to-point.dir/model/point-to-point-channel.cc.o.d"
+  "CMakeFiles/point-to-point.dir/model/point-to-point-net-device.cc.o"
+  "CMakeFiles/point-to-point.dir/model/point-to-point-net-device.cc.o.d"
+  "CMakeFiles/point-to-point.dir/model/ppp-header.cc.o"
+  "CMakeFiles/point-to-point.dir/model/ppp-header.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/point-to-point.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,35 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-propagation-default.pdb"
+  "../../out/lib/libns3-dev-propagation-default.so"
+  "CMakeFiles/propagation.dir/model/channel-condition-model.cc.o"
+  "CMakeFiles/propagation.dir/model/channel-condition-model.cc.o.d"
+  "CMakeFiles/propagation.dir/model/cost231-propagation-loss-model.cc.o"
+  "CMakeFiles/propagation.dir/model/cost231-propagation-loss-model.cc.o.d"
+  "CMakeFiles/propagation.dir/model/itu-r-1411-los-propagation-loss-model.cc.o"
+  "CMakeFiles/propagation.dir/model/itu-r-1411-los-propagation-loss-model.cc.o.d"
+  "CMakeFiles/propagation.dir/model/itu-r-1411-nlos-over-rooftop-propagation-loss-model.cc.o"
+  "CMakeFiles/propagation.dir/model/itu-r-1411-nlos-over-rooftop-propagation-loss-model.cc.o.d"
+  "CMakeFiles/propagation.dir/model/jakes-process.cc.o"
+  "CMakeFiles/propagation.dir/model/jakes-process.cc.o.d"
+  "CMakeFiles/propagation.dir/model/jakes-propagation-loss-model.cc.o"
+  "CMakeFiles/propagation.dir/model/jakes-propagation-loss-model.cc.o.d"
+  "CMakeFiles/propagation.dir/model/kun-2600-mhz-propagation-loss-model.cc.o"
+  "CMakeFiles/propagation.dir/model/kun-2600-mhz-propagation-loss-model.cc.o.d"
+  "CMakeFiles/propagation.dir/model/okumura-hata-propagation-loss-model.cc.o"
+  "CMakeFiles/propagation.dir/model/okumura-hata-propagation-loss-model.cc.o.d"
+  "CMakeFiles/propagation.dir/model/probabilistic-v2v-channel-condition-model.cc.o"
+  "CMakeFiles/propagation.dir/model/probabilistic-v2v-channel-condition-model.cc.o.d"
+  "CMakeFiles/propagation.dir/model/propagation-delay-model.cc.o"
+  "CMakeFiles/propagation.dir/model/propagation-delay-model.cc.o.d"
+  "CMakeFiles/propagation.dir/model/propagation-loss-model.cc.o"
+  "CMakeFiles/propagation.dir/model/propagation-loss-model.cc.o.d"
+  "CMakeFiles/propagation.dir/model/three-gpp-propagation-loss-model.cc.o"
+  "CMakeFiles/propagation.dir/model/three-gpp-propagation-loss-model.cc.o.d"
+  "CMakeFiles/propagation.dir/model/three-gpp-v2v-propagation-loss-model.cc.o"
+  "CMakeFiles/propagation.dir/model/three-gpp-v2v-propagation-loss-model.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/propagation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
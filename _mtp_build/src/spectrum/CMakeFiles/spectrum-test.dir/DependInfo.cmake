@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/spectrum/test/spectrum-ideal-phy-test.cc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/spectrum-ideal-phy-test.cc.o" "gcc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/spectrum-ideal-phy-test.cc.o.d"
+  "/root/repo/src/spectrum/test/spectrum-interference-test.cc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/spectrum-interference-test.cc.o" "gcc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/spectrum-interference-test.cc.o.d"
+  "/root/repo/src/spectrum/test/spectrum-value-test.cc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/spectrum-value-test.cc.o" "gcc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/spectrum-value-test.cc.o.d"
+  "/root/repo/src/spectrum/test/spectrum-waveform-generator-test.cc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/spectrum-waveform-generator-test.cc.o" "gcc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/spectrum-waveform-generator-test.cc.o.d"
+  "/root/repo/src/spectrum/test/three-gpp-channel-test-suite.cc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/three-gpp-channel-test-suite.cc.o" "gcc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/three-gpp-channel-test-suite.cc.o.d"
+  "/root/repo/src/spectrum/test/tv-helper-distribution-test.cc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/tv-helper-distribution-test.cc.o" "gcc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/tv-helper-distribution-test.cc.o.d"
+  "/root/repo/src/spectrum/test/tv-spectrum-transmitter-test.cc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/tv-spectrum-transmitter-test.cc.o" "gcc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/tv-spectrum-transmitter-test.cc.o.d"
+  "/root/repo/src/spectrum/test/two-ray-splm-test-suite.cc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/two-ray-splm-test-suite.cc.o" "gcc" "src/spectrum/CMakeFiles/spectrum-test.dir/test/two-ray-splm-test-suite.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mtp_build/src/spectrum/CMakeFiles/spectrum.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/propagation/CMakeFiles/propagation.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/mobility/CMakeFiles/mobility.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/antenna/CMakeFiles/antenna.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
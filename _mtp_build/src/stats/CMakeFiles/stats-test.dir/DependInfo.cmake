@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/stats/test/average-test-suite.cc" "src/stats/CMakeFiles/stats-test.dir/test/average-test-suite.cc.o" "gcc" "src/stats/CMakeFiles/stats-test.dir/test/average-test-suite.cc.o.d"
+  "/root/repo/src/stats/test/basic-data-calculators-test-suite.cc" "src/stats/CMakeFiles/stats-test.dir/test/basic-data-calculators-test-suite.cc.o" "gcc" "src/stats/CMakeFiles/stats-test.dir/test/basic-data-calculators-test-suite.cc.o.d"
+  "/root/repo/src/stats/test/double-probe-test-suite.cc" "src/stats/CMakeFiles/stats-test.dir/test/double-probe-test-suite.cc.o" "gcc" "src/stats/CMakeFiles/stats-test.dir/test/double-probe-test-suite.cc.o.d"
+  "/root/repo/src/stats/test/histogram-test-suite.cc" "src/stats/CMakeFiles/stats-test.dir/test/histogram-test-suite.cc.o" "gcc" "src/stats/CMakeFiles/stats-test.dir/test/histogram-test-suite.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mtp_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-stats-test-default.pdb"
+  "../../out/lib/libns3-dev-stats-test-default.so"
+  "CMakeFiles/stats-test.dir/test/average-test-suite.cc.o"
+  "CMakeFiles/stats-test.dir/test/average-test-suite.cc.o.d"
+  "CMakeFiles/stats-test.dir/test/basic-data-calculators-test-suite.cc.o"
+  "CMakeFiles/stats-test.dir/test/basic-data-calculators-test-suite.cc.o.d"
+  "CMakeFiles/stats-test.dir/test/double-probe-test-suite.cc.o"
+  "CMakeFiles/stats-test.dir/test/double-probe-test-suite.cc.o.d"
+  "CMakeFiles/stats-test.dir/test/histogram-test-suite.cc.o"
+  "CMakeFiles/stats-test.dir/test/histogram-test-suite.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stats-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
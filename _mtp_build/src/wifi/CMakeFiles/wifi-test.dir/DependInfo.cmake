@@ -0,0 +1,68 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/src/wifi/test/block-ack-test-suite.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/block-ack-test-suite.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/block-ack-test-suite.cc.o.d"
+  "/root/repo/src/wifi/test/channel-access-manager-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/channel-access-manager-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/channel-access-manager-test.cc.o.d"
+  "/root/repo/src/wifi/test/inter-bss-test-suite.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/inter-bss-test-suite.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/inter-bss-test-suite.cc.o.d"
+  "/root/repo/src/wifi/test/power-rate-adaptation-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/power-rate-adaptation-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/power-rate-adaptation-test.cc.o.d"
+  "/root/repo/src/wifi/test/power-save-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/power-save-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/power-save-test.cc.o.d"
+  "/root/repo/src/wifi/test/spectrum-wifi-phy-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/spectrum-wifi-phy-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/spectrum-wifi-phy-test.cc.o.d"
+  "/root/repo/src/wifi/test/tx-duration-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/tx-duration-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/tx-duration-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-aggregation-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-aggregation-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-aggregation-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-channel-settings-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-channel-settings-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-channel-settings-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-channel-switching-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-channel-switching-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-channel-switching-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-co-trace-helper-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-co-trace-helper-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-co-trace-helper-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-dynamic-bw-op-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-dynamic-bw-op-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-dynamic-bw-op-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-eht-info-elems-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-eht-info-elems-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-eht-info-elems-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-emlsr-basic-exchanges-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-emlsr-basic-exchanges-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-emlsr-basic-exchanges-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-emlsr-enabling-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-emlsr-enabling-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-emlsr-enabling-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-emlsr-link-switch-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-emlsr-link-switch-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-emlsr-link-switch-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-emlsr-test-base.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-emlsr-test-base.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-emlsr-test-base.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-error-rate-models-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-error-rate-models-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-error-rate-models-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-fils-frame-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-fils-frame-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-fils-frame-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-gcr-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-gcr-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-gcr-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-he-info-elems-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-he-info-elems-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-he-info-elems-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-ie-fragment-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-ie-fragment-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-ie-fragment-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-mac-ofdma-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-mac-ofdma-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-mac-ofdma-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-mac-queue-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-mac-queue-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-mac-queue-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-mlo-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-mlo-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-mlo-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-non-ht-dup-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-non-ht-dup-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-non-ht-dup-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-operating-channel-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-operating-channel-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-operating-channel-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-phy-cca-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-phy-cca-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-phy-cca-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-phy-mu-mimo-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-phy-mu-mimo-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-phy-mu-mimo-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-phy-ofdma-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-phy-ofdma-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-phy-ofdma-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-phy-reception-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-phy-reception-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-phy-reception-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-phy-rx-trace-helper-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-phy-rx-trace-helper-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-phy-rx-trace-helper-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-phy-thresholds-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-phy-thresholds-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-phy-thresholds-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-primary-channels-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-primary-channels-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-primary-channels-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-probe-exchange-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-probe-exchange-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-probe-exchange-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-retransmit-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-retransmit-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-retransmit-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-ru-allocation-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-ru-allocation-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-ru-allocation-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-transmit-mask-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-transmit-mask-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-transmit-mask-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-tx-stats-helper-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-tx-stats-helper-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-tx-stats-helper-test.cc.o.d"
+  "/root/repo/src/wifi/test/wifi-txop-test.cc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-txop-test.cc.o" "gcc" "src/wifi/CMakeFiles/wifi-test.dir/test/wifi-txop-test.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_mtp_build/src/wifi/CMakeFiles/wifi.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/energy/CMakeFiles/energy.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/spectrum/CMakeFiles/spectrum.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/propagation/CMakeFiles/propagation.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/mobility/CMakeFiles/mobility.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/network/CMakeFiles/network.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/stats/CMakeFiles/stats.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/antenna/CMakeFiles/antenna.dir/DependInfo.cmake"
+  "/root/repo/_mtp_build/src/core/CMakeFiles/core.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
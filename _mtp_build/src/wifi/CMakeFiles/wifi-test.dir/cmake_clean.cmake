@@ -0,0 +1,91 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-wifi-test-default.pdb"
+  "../../out/lib/libns3-dev-wifi-test-default.so"
+  "CMakeFiles/wifi-test.dir/test/block-ack-test-suite.cc.o"
+  "CMakeFiles/wifi-test.dir/test/block-ack-test-suite.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/channel-access-manager-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/channel-access-manager-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/inter-bss-test-suite.cc.o"
+  "CMakeFiles/wifi-test.dir/test/inter-bss-test-suite.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/power-rate-adaptation-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/power-rate-adaptation-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/power-save-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/power-save-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/spectrum-wifi-phy-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/spectrum-wifi-phy-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/tx-duration-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/tx-duration-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-aggregation-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-aggregation-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-channel-settings-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-channel-settings-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-channel-switching-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-channel-switching-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-co-trace-helper-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-co-trace-helper-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-dynamic-bw-op-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-dynamic-bw-op-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-eht-info-elems-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-eht-info-elems-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-emlsr-basic-exchanges-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-emlsr-basic-exchanges-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-emlsr-enabling-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-emlsr-enabling-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-emlsr-link-switch-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-emlsr-link-switch-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-emlsr-test-base.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-emlsr-test-base.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-error-rate-models-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-error-rate-models-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-fils-frame-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-fils-frame-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-gcr-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-gcr-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-he-info-elems-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-he-info-elems-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-ie-fragment-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-ie-fragment-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-mac-ofdma-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-mac-ofdma-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-mac-queue-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-mac-queue-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-mlo-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-mlo-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-non-ht-dup-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-non-ht-dup-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-operating-channel-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-operating-channel-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-phy-cca-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-phy-cca-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-phy-mu-mimo-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-phy-mu-mimo-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-phy-ofdma-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-phy-ofdma-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-phy-reception-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-phy-reception-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-phy-rx-trace-helper-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-phy-rx-trace-helper-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-phy-thresholds-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-phy-thresholds-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-primary-channels-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-primary-channels-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-probe-exchange-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-probe-exchange-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-retransmit-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-retransmit-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-ru-allocation-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-ru-allocation-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-transmit-mask-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-transmit-mask-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-tx-stats-helper-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-tx-stats-helper-test.cc.o.d"
+  "CMakeFiles/wifi-test.dir/test/wifi-txop-test.cc.o"
+  "CMakeFiles/wifi-test.dir/test/wifi-txop-test.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wifi-test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,351 @@
+file(REMOVE_RECURSE
+  "../../out/lib/libns3-dev-wifi-default.pdb"
+  "../../out/lib/libns3-dev-wifi-default.so"
+  "CMakeFiles/wifi.dir/helper/athstats-helper.cc.o"
+  "CMakeFiles/wifi.dir/helper/athstats-helper.cc.o.d"
+  "CMakeFiles/wifi.dir/helper/spectrum-wifi-helper.cc.o"
+  "CMakeFiles/wifi.dir/helper/spectrum-wifi-helper.cc.o.d"
+  "CMakeFiles/wifi.dir/helper/wifi-co-trace-helper.cc.o"
+  "CMakeFiles/wifi.dir/helper/wifi-co-trace-helper.cc.o.d"
+  "CMakeFiles/wifi.dir/helper/wifi-helper.cc.o"
+  "CMakeFiles/wifi.dir/helper/wifi-helper.cc.o.d"
+  "CMakeFiles/wifi.dir/helper/wifi-mac-helper.cc.o"
+  "CMakeFiles/wifi.dir/helper/wifi-mac-helper.cc.o.d"
+  "CMakeFiles/wifi.dir/helper/wifi-phy-rx-trace-helper.cc.o"
+  "CMakeFiles/wifi.dir/helper/wifi-phy-rx-trace-helper.cc.o.d"
+  "CMakeFiles/wifi.dir/helper/wifi-radio-energy-model-helper.cc.o"
+  "CMakeFiles/wifi.dir/helper/wifi-radio-energy-model-helper.cc.o.d"
+  "CMakeFiles/wifi.dir/helper/wifi-tx-stats-helper.cc.o"
+  "CMakeFiles/wifi.dir/helper/wifi-tx-stats-helper.cc.o.d"
+  "CMakeFiles/wifi.dir/helper/yans-wifi-helper.cc.o"
+  "CMakeFiles/wifi.dir/helper/yans-wifi-helper.cc.o.d"
+  "CMakeFiles/wifi.dir/model/addba-extension.cc.o"
+  "CMakeFiles/wifi.dir/model/addba-extension.cc.o.d"
+  "CMakeFiles/wifi.dir/model/adhoc-wifi-mac.cc.o"
+  "CMakeFiles/wifi.dir/model/adhoc-wifi-mac.cc.o.d"
+  "CMakeFiles/wifi.dir/model/ampdu-subframe-header.cc.o"
+  "CMakeFiles/wifi.dir/model/ampdu-subframe-header.cc.o.d"
+  "CMakeFiles/wifi.dir/model/ampdu-tag.cc.o"
+  "CMakeFiles/wifi.dir/model/ampdu-tag.cc.o.d"
+  "CMakeFiles/wifi.dir/model/amsdu-subframe-header.cc.o"
+  "CMakeFiles/wifi.dir/model/amsdu-subframe-header.cc.o.d"
+  "CMakeFiles/wifi.dir/model/ap-wifi-mac.cc.o"
+  "CMakeFiles/wifi.dir/model/ap-wifi-mac.cc.o.d"
+  "CMakeFiles/wifi.dir/model/block-ack-agreement.cc.o"
+  "CMakeFiles/wifi.dir/model/block-ack-agreement.cc.o.d"
+  "CMakeFiles/wifi.dir/model/block-ack-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/block-ack-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/block-ack-type.cc.o"
+  "CMakeFiles/wifi.dir/model/block-ack-type.cc.o.d"
+  "CMakeFiles/wifi.dir/model/block-ack-window.cc.o"
+  "CMakeFiles/wifi.dir/model/block-ack-window.cc.o.d"
+  "CMakeFiles/wifi.dir/model/capability-information.cc.o"
+  "CMakeFiles/wifi.dir/model/capability-information.cc.o.d"
+  "CMakeFiles/wifi.dir/model/channel-access-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/channel-access-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/ctrl-headers.cc.o"
+  "CMakeFiles/wifi.dir/model/ctrl-headers.cc.o.d"
+  "CMakeFiles/wifi.dir/model/edca-parameter-set.cc.o"
+  "CMakeFiles/wifi.dir/model/edca-parameter-set.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/advanced-ap-emlsr-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/advanced-ap-emlsr-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/advanced-emlsr-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/advanced-emlsr-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/ap-emlsr-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/ap-emlsr-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/common-info-basic-mle.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/common-info-basic-mle.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/common-info-probe-req-mle.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/common-info-probe-req-mle.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/default-ap-emlsr-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/default-ap-emlsr-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/default-emlsr-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/default-emlsr-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/eht-capabilities.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/eht-capabilities.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/eht-configuration.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/eht-configuration.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/eht-frame-exchange-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/eht-frame-exchange-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/eht-operation.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/eht-operation.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/eht-phy.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/eht-phy.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/eht-ppdu.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/eht-ppdu.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/eht-ru.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/eht-ru.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/emlsr-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/emlsr-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/multi-link-element.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/multi-link-element.cc.o.d"
+  "CMakeFiles/wifi.dir/model/eht/tid-to-link-mapping-element.cc.o"
+  "CMakeFiles/wifi.dir/model/eht/tid-to-link-mapping-element.cc.o.d"
+  "CMakeFiles/wifi.dir/model/error-rate-cache.cc.o"
+  "CMakeFiles/wifi.dir/model/error-rate-cache.cc.o.d"
+  "CMakeFiles/wifi.dir/model/error-rate-model.cc.o"
+  "CMakeFiles/wifi.dir/model/error-rate-model.cc.o.d"
+  "CMakeFiles/wifi.dir/model/extended-capabilities.cc.o"
+  "CMakeFiles/wifi.dir/model/extended-capabilities.cc.o.d"
+  "CMakeFiles/wifi.dir/model/fcfs-wifi-queue-scheduler.cc.o"
+  "CMakeFiles/wifi.dir/model/fcfs-wifi-queue-scheduler.cc.o.d"
+  "CMakeFiles/wifi.dir/model/frame-capture-model.cc.o"
+  "CMakeFiles/wifi.dir/model/frame-capture-model.cc.o.d"
+  "CMakeFiles/wifi.dir/model/frame-exchange-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/frame-exchange-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/gcr-group-address.cc.o"
+  "CMakeFiles/wifi.dir/model/gcr-group-address.cc.o.d"
+  "CMakeFiles/wifi.dir/model/gcr-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/gcr-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/he/constant-obss-pd-algorithm.cc.o"
+  "CMakeFiles/wifi.dir/model/he/constant-obss-pd-algorithm.cc.o.d"
+  "CMakeFiles/wifi.dir/model/he/he-6ghz-band-capabilities.cc.o"
+  "CMakeFiles/wifi.dir/model/he/he-6ghz-band-capabilities.cc.o.d"
+  "CMakeFiles/wifi.dir/model/he/he-capabilities.cc.o"
+  "CMakeFiles/wifi.dir/model/he/he-capabilities.cc.o.d"
+  "CMakeFiles/wifi.dir/model/he/he-configuration.cc.o"
+  "CMakeFiles/wifi.dir/model/he/he-configuration.cc.o.d"
+  "CMakeFiles/wifi.dir/model/he/he-frame-exchange-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/he/he-frame-exchange-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/he/he-operation.cc.o"
+  "CMakeFiles/wifi.dir/model/he/he-operation.cc.o.d"
+  "CMakeFiles/wifi.dir/model/he/he-phy.cc.o"
+  "CMakeFiles/wifi.dir/model/he/he-phy.cc.o.d"
+  "CMakeFiles/wifi.dir/model/he/he-ppdu.cc.o"
+  "CMakeFiles/wifi.dir/model/he/he-ppdu.cc.o.d"
+  "CMakeFiles/wifi.dir/model/he/he-ru.cc.o"
+  "CMakeFiles/wifi.dir/model/he/he-ru.cc.o.d"
+  "CMakeFiles/wifi.dir/model/he/mu-edca-parameter-set.cc.o"
+  "CMakeFiles/wifi.dir/model/he/mu-edca-parameter-set.cc.o.d"
+  "CMakeFiles/wifi.dir/model/he/mu-snr-tag.cc.o"
+  "CMakeFiles/wifi.dir/model/he/mu-snr-tag.cc.o.d"
+  "CMakeFiles/wifi.dir/model/he/multi-user-scheduler.cc.o"
+  "CMakeFiles/wifi.dir/model/he/multi-user-scheduler.cc.o.d"
+  "CMakeFiles/wifi.dir/model/he/obss-pd-algorithm.cc.o"
+  "CMakeFiles/wifi.dir/model/he/obss-pd-algorithm.cc.o.d"
+  "CMakeFiles/wifi.dir/model/he/rr-multi-user-scheduler.cc.o"
+  "CMakeFiles/wifi.dir/model/he/rr-multi-user-scheduler.cc.o.d"
+  "CMakeFiles/wifi.dir/model/ht/ht-capabilities.cc.o"
+  "CMakeFiles/wifi.dir/model/ht/ht-capabilities.cc.o.d"
+  "CMakeFiles/wifi.dir/model/ht/ht-configuration.cc.o"
+  "CMakeFiles/wifi.dir/model/ht/ht-configuration.cc.o.d"
+  "CMakeFiles/wifi.dir/model/ht/ht-frame-exchange-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/ht/ht-frame-exchange-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/ht/ht-operation.cc.o"
+  "CMakeFiles/wifi.dir/model/ht/ht-operation.cc.o.d"
+  "CMakeFiles/wifi.dir/model/ht/ht-phy.cc.o"
+  "CMakeFiles/wifi.dir/model/ht/ht-phy.cc.o.d"
+  "CMakeFiles/wifi.dir/model/ht/ht-ppdu.cc.o"
+  "CMakeFiles/wifi.dir/model/ht/ht-ppdu.cc.o.d"
+  "CMakeFiles/wifi.dir/model/interference-helper.cc.o"
+  "CMakeFiles/wifi.dir/model/interference-helper.cc.o.d"
+  "CMakeFiles/wifi.dir/model/mac-rx-middle.cc.o"
+  "CMakeFiles/wifi.dir/model/mac-rx-middle.cc.o.d"
+  "CMakeFiles/wifi.dir/model/mac-tx-middle.cc.o"
+  "CMakeFiles/wifi.dir/model/mac-tx-middle.cc.o.d"
+  "CMakeFiles/wifi.dir/model/mgt-action-headers.cc.o"
+  "CMakeFiles/wifi.dir/model/mgt-action-headers.cc.o.d"
+  "CMakeFiles/wifi.dir/model/mgt-headers.cc.o"
+  "CMakeFiles/wifi.dir/model/mgt-headers.cc.o.d"
+  "CMakeFiles/wifi.dir/model/mpdu-aggregator.cc.o"
+  "CMakeFiles/wifi.dir/model/mpdu-aggregator.cc.o.d"
+  "CMakeFiles/wifi.dir/model/msdu-aggregator.cc.o"
+  "CMakeFiles/wifi.dir/model/msdu-aggregator.cc.o.d"
+  "CMakeFiles/wifi.dir/model/nist-error-rate-model.cc.o"
+  "CMakeFiles/wifi.dir/model/nist-error-rate-model.cc.o.d"
+  "CMakeFiles/wifi.dir/model/non-ht/dsss-error-rate-model.cc.o"
+  "CMakeFiles/wifi.dir/model/non-ht/dsss-error-rate-model.cc.o.d"
+  "CMakeFiles/wifi.dir/model/non-ht/dsss-parameter-set.cc.o"
+  "CMakeFiles/wifi.dir/model/non-ht/dsss-parameter-set.cc.o.d"
+  "CMakeFiles/wifi.dir/model/non-ht/dsss-phy.cc.o"
+  "CMakeFiles/wifi.dir/model/non-ht/dsss-phy.cc.o.d"
+  "CMakeFiles/wifi.dir/model/non-ht/dsss-ppdu.cc.o"
+  "CMakeFiles/wifi.dir/model/non-ht/dsss-ppdu.cc.o.d"
+  "CMakeFiles/wifi.dir/model/non-ht/erp-information.cc.o"
+  "CMakeFiles/wifi.dir/model/non-ht/erp-information.cc.o.d"
+  "CMakeFiles/wifi.dir/model/non-ht/erp-ofdm-phy.cc.o"
+  "CMakeFiles/wifi.dir/model/non-ht/erp-ofdm-phy.cc.o.d"
+  "CMakeFiles/wifi.dir/model/non-ht/erp-ofdm-ppdu.cc.o"
+  "CMakeFiles/wifi.dir/model/non-ht/erp-ofdm-ppdu.cc.o.d"
+  "CMakeFiles/wifi.dir/model/non-ht/ofdm-phy.cc.o"
+  "CMakeFiles/wifi.dir/model/non-ht/ofdm-phy.cc.o.d"
+  "CMakeFiles/wifi.dir/model/non-ht/ofdm-ppdu.cc.o"
+  "CMakeFiles/wifi.dir/model/non-ht/ofdm-ppdu.cc.o.d"
+  "CMakeFiles/wifi.dir/model/non-inheritance.cc.o"
+  "CMakeFiles/wifi.dir/model/non-inheritance.cc.o.d"
+  "CMakeFiles/wifi.dir/model/originator-block-ack-agreement.cc.o"
+  "CMakeFiles/wifi.dir/model/originator-block-ack-agreement.cc.o.d"
+  "CMakeFiles/wifi.dir/model/phy-entity.cc.o"
+  "CMakeFiles/wifi.dir/model/phy-entity.cc.o.d"
+  "CMakeFiles/wifi.dir/model/preamble-detection-model.cc.o"
+  "CMakeFiles/wifi.dir/model/preamble-detection-model.cc.o.d"
+  "CMakeFiles/wifi.dir/model/qos-frame-exchange-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/qos-frame-exchange-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/qos-txop.cc.o"
+  "CMakeFiles/wifi.dir/model/qos-txop.cc.o.d"
+  "CMakeFiles/wifi.dir/model/qos-utils.cc.o"
+  "CMakeFiles/wifi.dir/model/qos-utils.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/aarf-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/aarf-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/aarfcd-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/aarfcd-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/amrr-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/amrr-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/aparf-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/aparf-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/arf-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/arf-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/cara-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/cara-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/constant-rate-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/constant-rate-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/ideal-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/ideal-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/minstrel-ht-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/minstrel-ht-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/minstrel-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/minstrel-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/onoe-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/onoe-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/parf-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/parf-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/rraa-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/rraa-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/rrpaa-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/rrpaa-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/rate-control/thompson-sampling-wifi-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/rate-control/thompson-sampling-wifi-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/recipient-block-ack-agreement.cc.o"
+  "CMakeFiles/wifi.dir/model/recipient-block-ack-agreement.cc.o.d"
+  "CMakeFiles/wifi.dir/model/reduced-neighbor-report.cc.o"
+  "CMakeFiles/wifi.dir/model/reduced-neighbor-report.cc.o.d"
+  "CMakeFiles/wifi.dir/model/reference/error-rate-tables.cc.o"
+  "CMakeFiles/wifi.dir/model/reference/error-rate-tables.cc.o.d"
+  "CMakeFiles/wifi.dir/model/simple-frame-capture-model.cc.o"
+  "CMakeFiles/wifi.dir/model/simple-frame-capture-model.cc.o.d"
+  "CMakeFiles/wifi.dir/model/snr-tag.cc.o"
+  "CMakeFiles/wifi.dir/model/snr-tag.cc.o.d"
+  "CMakeFiles/wifi.dir/model/spectrum-wifi-phy.cc.o"
+  "CMakeFiles/wifi.dir/model/spectrum-wifi-phy.cc.o.d"
+  "CMakeFiles/wifi.dir/model/ssid.cc.o"
+  "CMakeFiles/wifi.dir/model/ssid.cc.o.d"
+  "CMakeFiles/wifi.dir/model/sta-wifi-mac.cc.o"
+  "CMakeFiles/wifi.dir/model/sta-wifi-mac.cc.o.d"
+  "CMakeFiles/wifi.dir/model/status-code.cc.o"
+  "CMakeFiles/wifi.dir/model/status-code.cc.o.d"
+  "CMakeFiles/wifi.dir/model/supported-rates.cc.o"
+  "CMakeFiles/wifi.dir/model/supported-rates.cc.o.d"
+  "CMakeFiles/wifi.dir/model/table-based-error-rate-model.cc.o"
+  "CMakeFiles/wifi.dir/model/table-based-error-rate-model.cc.o.d"
+  "CMakeFiles/wifi.dir/model/threshold-preamble-detection-model.cc.o"
+  "CMakeFiles/wifi.dir/model/threshold-preamble-detection-model.cc.o.d"
+  "CMakeFiles/wifi.dir/model/tim.cc.o"
+  "CMakeFiles/wifi.dir/model/tim.cc.o.d"
+  "CMakeFiles/wifi.dir/model/txop.cc.o"
+  "CMakeFiles/wifi.dir/model/txop.cc.o.d"
+  "CMakeFiles/wifi.dir/model/vht/vht-capabilities.cc.o"
+  "CMakeFiles/wifi.dir/model/vht/vht-capabilities.cc.o.d"
+  "CMakeFiles/wifi.dir/model/vht/vht-configuration.cc.o"
+  "CMakeFiles/wifi.dir/model/vht/vht-configuration.cc.o.d"
+  "CMakeFiles/wifi.dir/model/vht/vht-frame-exchange-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/vht/vht-frame-exchange-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/vht/vht-operation.cc.o"
+  "CMakeFiles/wifi.dir/model/vht/vht-operation.cc.o.d"
+  "CMakeFiles/wifi.dir/model/vht/vht-phy.cc.o"
+  "CMakeFiles/wifi.dir/model/vht/vht-phy.cc.o.d"
+  "CMakeFiles/wifi.dir/model/vht/vht-ppdu.cc.o"
+  "CMakeFiles/wifi.dir/model/vht/vht-ppdu.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-ack-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-ack-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-acknowledgment.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-acknowledgment.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-assoc-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-assoc-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-bandwidth-filter.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-bandwidth-filter.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-constants.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-constants.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-default-ack-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-default-ack-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-default-assoc-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-default-assoc-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-default-gcr-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-default-gcr-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-default-protection-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-default-protection-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-information-element.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-information-element.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-mac-header.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-mac-header.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-mac-queue-container.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-mac-queue-container.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-mac-queue-elem.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-mac-queue-elem.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-mac-queue-scheduler.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-mac-queue-scheduler.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-mac-queue.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-mac-queue.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-mac-trailer.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-mac-trailer.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-mac.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-mac.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-mode.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-mode.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-mpdu.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-mpdu.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-net-device.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-net-device.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-phy-common.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-phy-common.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-phy-operating-channel.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-phy-operating-channel.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-phy-state-helper.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-phy-state-helper.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-phy.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-phy.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-ppdu.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-ppdu.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-protection-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-protection-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-protection.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-protection.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-psdu.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-psdu.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-radio-energy-model.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-radio-energy-model.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-remote-station-info.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-remote-station-info.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-remote-station-manager.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-remote-station-manager.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-ru.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-ru.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-spectrum-phy-interface.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-spectrum-phy-interface.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-spectrum-signal-parameters.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-spectrum-signal-parameters.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-spectrum-value-helper.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-spectrum-value-helper.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-standards.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-standards.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-tx-current-model.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-tx-current-model.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-tx-parameters.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-tx-parameters.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-tx-timer.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-tx-timer.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-tx-vector.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-tx-vector.cc.o.d"
+  "CMakeFiles/wifi.dir/model/wifi-utils.cc.o"
+  "CMakeFiles/wifi.dir/model/wifi-utils.cc.o.d"
+  "CMakeFiles/wifi.dir/model/yans-error-rate-model.cc.o"
+  "CMakeFiles/wifi.dir/model/yans-error-rate-model.cc.o.d"
+  "CMakeFiles/wifi.dir/model/yans-wifi-channel.cc.o"
+  "CMakeFiles/wifi.dir/model/yans-wifi-channel.cc.o.d"
+  "CMakeFiles/wifi.dir/model/yans-wifi-phy.cc.o"
+  "CMakeFiles/wifi.dir/model/yans-wifi-phy.cc.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wifi.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()